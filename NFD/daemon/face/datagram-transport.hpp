@@ -178,22 +178,30 @@ DatagramTransport<T, U>::receiveDatagram(const uint8_t* buffer, size_t nBytesRec
 
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes from " << m_sender);
 
-  bool isOk = false;
-  Block element;
-  std::tie(isOk, element) = Block::fromBuffer(buffer, nBytesReceived);
-  if (!isOk) {
-    NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << m_sender);
-    // This packet won't extend the face lifetime
-    return;
+  // A datagram may carry several packets bundled by the sender
+  std::vector<Block> elements;
+  size_t offset = 0;
+  while (offset < nBytesReceived) {
+    bool isOk = false;
+    Block element;
+    std::tie(isOk, element) = Block::fromBuffer(buffer + offset, nBytesReceived - offset);
+    if (!isOk) {
+      NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << m_sender);
+      // This packet won't extend the face lifetime
+      return;
+    }
+    offset += element.size();
+    elements.push_back(std::move(element));
   }
-  if (element.size() != nBytesReceived) {
-    NFD_LOG_FACE_WARN("Received datagram size and decoded element size don't match");
-    // This packet won't extend the face lifetime
+  if (elements.empty()) {
     return;
   }
   m_hasRecentlyReceived = true;
 
-  this->receive(element, makeEndpointId(m_sender));
+  EndpointId endpoint = makeEndpointId(m_sender);
+  for (const Block& element : elements) {
+    this->receive(element, endpoint);
+  }
 }
 
 template<class T, class U>
@@ -60,7 +60,9 @@ public:
    * one needs to explicitly call EthernetChannel::listen method.
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  bool wantBundling,
+                  bool wantPitToken);
 
   bool
   isListening() const override
@@ -129,6 +131,8 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const bool m_wantBundling; ///< Whether faces bundle several LpPackets in one frame
+  const bool m_wantPitToken; ///< Whether faces attach PIT tokens to outgoing Interests
 
 #ifdef _DEBUG
   /// number of frames dropped by the kernel, as reported by libpcap
@@ -60,6 +60,8 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   // {
   //   listen yes
   //   idle_timeout 600
+  //   bundling no
+  //   pit_token no
   //   mcast yes
   //   mcast_group 01:00:5E:00:17:AA
   //   mcast_ad_hoc no
@@ -89,6 +91,14 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         unicastConfig.idleTimeout = time::seconds(ConfigFile::parseNumber<uint32_t>(pair, "face_system.ether"));
       }
+      else if (key == "bundling") {
+        unicastConfig.wantBundling = mcastConfig.wantBundling =
+          ConfigFile::parseYesNo(pair, "face_system.ether");
+      }
+      else if (key == "pit_token") {
+        unicastConfig.wantPitToken = mcastConfig.wantPitToken =
+          ConfigFile::parseYesNo(pair, "face_system.ether");
+      }
       else if (key == "mcast") {
         mcastConfig.isEnabled = ConfigFile::parseYesNo(pair, "face_system.ether");
       }
@@ -131,6 +141,12 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     if (m_unicastConfig.idleTimeout != unicastConfig.idleTimeout && !m_channels.empty()) {
       NFD_LOG_WARN("Idle timeout setting applies to new Ethernet channels only");
     }
+    if (m_unicastConfig.wantBundling != unicastConfig.wantBundling && !m_channels.empty()) {
+      NFD_LOG_WARN("Bundling setting applies to new Ethernet channels only");
+    }
+    if (m_unicastConfig.wantPitToken != unicastConfig.wantPitToken && !m_channels.empty()) {
+      NFD_LOG_WARN("PIT token setting applies to new Ethernet channels only");
+    }
   }
   else if (m_unicastConfig.isEnabled && !m_channels.empty()) {
     NFD_LOG_WARN("Cannot disable Ethernet channels after initialization");
@@ -148,6 +164,12 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     if (m_mcastConfig.linkType != mcastConfig.linkType && !m_mcastFaces.empty()) {
       NFD_LOG_WARN("Cannot change ad hoc setting on existing faces");
     }
+    if (m_mcastConfig.wantBundling != mcastConfig.wantBundling && !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("Cannot change bundling setting on existing faces");
+    }
+    if (m_mcastConfig.wantPitToken != mcastConfig.wantPitToken && !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("Cannot change PIT token setting on existing faces");
+    }
     if (m_mcastConfig.group != mcastConfig.group) {
       NFD_LOG_INFO("changing multicast group from " << m_mcastConfig.group <<
                    " to " << mcastConfig.group);
@@ -223,7 +245,9 @@ EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout,
+                                                   m_unicastConfig.wantBundling,
+                                                   m_unicastConfig.wantPitToken);
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -249,6 +273,8 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   GenericLinkService::Options opts;
   opts.allowFragmentation = true;
   opts.allowReassembly = true;
+  opts.allowBundling = m_mcastConfig.wantBundling;
+  opts.allowPitToken = m_mcastConfig.wantPitToken;
 
   auto linkService = make_unique<GenericLinkService>(opts);
   auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
@@ -110,6 +110,8 @@ private:
     bool isEnabled = false;
     bool wantListen = false;
     time::nanoseconds idleTimeout = 10_min;
+    bool wantBundling = false;
+    bool wantPitToken = false;
   };
   UnicastConfig m_unicastConfig;
 
@@ -119,6 +121,8 @@ private:
     ethernet::Address group = ethernet::getDefaultMulticastAddress();
     ndn::nfd::LinkType linkType = ndn::nfd::LINK_TYPE_MULTI_ACCESS;
     NetworkInterfacePredicate netifPredicate;
+    bool wantBundling = false;
+    bool wantPitToken = false;
   };
   MulticastConfig m_mcastConfig;
 
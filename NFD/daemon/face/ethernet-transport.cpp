@@ -199,12 +199,23 @@ EthernetTransport::receivePayload(const uint8_t* payload, size_t length,
 {
   NFD_LOG_FACE_TRACE("Received: " << length << " bytes from " << sender);
 
-  bool isOk = false;
-  Block element;
-  std::tie(isOk, element) = Block::fromBuffer(payload, length);
-  if (!isOk) {
-    NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << sender);
-    // This packet won't extend the face lifetime
+  // A frame may carry several packets bundled by the sender. Short frames are padded with zeros,
+  // and since zero is not a valid TLV-TYPE, the first zero octet ends the sequence of packets.
+  std::vector<Block> elements;
+  size_t offset = 0;
+  while (offset < length && (elements.empty() || payload[offset] != 0)) {
+    bool isOk = false;
+    Block element;
+    std::tie(isOk, element) = Block::fromBuffer(payload + offset, length - offset);
+    if (!isOk) {
+      NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << sender);
+      // This packet won't extend the face lifetime
+      return;
+    }
+    offset += element.size();
+    elements.push_back(std::move(element));
+  }
+  if (elements.empty()) {
     return;
   }
   m_hasRecentlyReceived = true;
@@ -215,7 +226,9 @@ EthernetTransport::receivePayload(const uint8_t* payload, size_t length,
     std::memcpy(&endpoint, sender.data(), sender.size());
   }
 
-  this->receive(element, endpoint);
+  for (const Block& element : elements) {
+    this->receive(element, endpoint);
+  }
 }
 
 void
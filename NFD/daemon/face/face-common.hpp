@@ -78,6 +78,7 @@ struct FaceParams
   bool wantLocalFields = false;
   bool wantLpReliability = false;
   boost::logic::tribool wantCongestionMarking = boost::logic::indeterminate;
+  bool wantPitToken = false;
 };
 
 /** \brief For internal use by FaceLogging macros.
@@ -150,6 +150,11 @@ public: // dynamic properties
   time::steady_clock::TimePoint
   getExpirationTime() const;
 
+  /** \return estimated quality of the link to the remote endpoint
+   */
+  const LinkQualityEstimator&
+  getLinkQuality() const;
+
   /** \brief request the face to be closed
    *
    *  This operation is effective only if face is in UP or DOWN state,
@@ -263,6 +268,12 @@ Face::getExpirationTime() const
   return m_transport->getExpirationTime();
 }
 
+inline const LinkQualityEstimator&
+Face::getLinkQuality() const
+{
+  return m_transport->getLinkQuality();
+}
+
 inline void
 Face::close()
 {
@@ -24,6 +24,7 @@
  */
 
 #include "generic-link-service.hpp"
+#include "common/global.hpp"
 
 #include <ndn-cxx/lp/pit-token.hpp>
 #include <ndn-cxx/lp/tags.hpp>
@@ -39,6 +40,44 @@ constexpr size_t CONGESTION_MARK_SIZE = tlv::sizeOfVarNumber(lp::tlv::Congestion
                                         tlv::sizeOfVarNumber(sizeof(uint64_t)) +        // length
                                         tlv::sizeOfNonNegativeInteger(UINT64_MAX);      // value
 
+/// RFC 8289 recommends a TARGET of 5-10% of INTERVAL
+constexpr int SOJOURN_INTERVAL_TO_TARGET_RATIO = 20;
+
+/** \brief computes the size of an LpPacket with \p headerSize octets of header fields, followed
+ *         by a Fragment field carrying \p netPktSize octets
+ */
+static size_t
+computeLpPacketSize(size_t headerSize, size_t netPktSize)
+{
+  size_t valueSize = headerSize + tlv::sizeOfVarNumber(lp::tlv::Fragment) +
+                     tlv::sizeOfVarNumber(netPktSize) + netPktSize;
+  return tlv::sizeOfVarNumber(lp::tlv::LpPacket) + tlv::sizeOfVarNumber(valueSize) + valueSize;
+}
+
+/** \brief encodes an LpPacket with the header fields of \p headers and \p netPkt as fragment
+ *
+ *  The network layer packet is copied only once, unlike adding it as a FragmentField to
+ *  \p headers and then encoding the LpPacket.
+ */
+static Block
+encodeLpPacket(const Block& netPkt, const lp::Packet& headers)
+{
+  if (headers.empty()) {
+    // LpPacket without header fields is sent as the bare network layer packet
+    return netPkt;
+  }
+
+  Block headerWire = headers.wireEncode();
+  ndn::EncodingBuffer encoder(computeLpPacketSize(headerWire.value_size(), netPkt.size()), 0);
+  encoder.prependByteArray(netPkt.wire(), netPkt.size());
+  encoder.prependVarNumber(netPkt.size());
+  encoder.prependVarNumber(lp::tlv::Fragment);
+  encoder.prependByteArray(headerWire.value(), headerWire.value_size());
+  encoder.prependVarNumber(encoder.size());
+  encoder.prependVarNumber(lp::tlv::LpPacket);
+  return encoder.block();
+}
+
 GenericLinkService::GenericLinkService(const GenericLinkService::Options& options)
   : m_options(options)
   , m_fragmenter(m_options.fragmenterOptions, this)
@@ -60,6 +99,10 @@ GenericLinkService::setOptions(const GenericLinkService::Options& options)
   m_fragmenter.setOptions(m_options.fragmenterOptions);
   m_reassembler.setOptions(m_options.reassemblerOptions);
   m_reliability.setOptions(m_options.reliabilityOptions);
+
+  if (!m_options.allowBundling) {
+    this->flushBundle();
+  }
 }
 
 void
@@ -83,44 +126,97 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt, const EndpointId& endpointId)
     checkCongestionLevel(pkt);
   }
 
-  auto block = pkt.wireEncode();
+  this->sendFrame(pkt.wireEncode(), endpointId);
+}
+
+void
+GenericLinkService::sendFrame(const Block& block, const EndpointId& endpointId)
+{
+  const ssize_t mtu = this->getTransport()->getMtu();
   if (mtu != MTU_UNLIMITED && block.size() > static_cast<size_t>(mtu)) {
     ++this->nOutOverMtu;
     NFD_LOG_FACE_WARN("attempted to send packet over MTU limit");
     return;
   }
-  this->sendPacket(block, endpointId);
+
+  if (m_options.allowBundling && mtu != MTU_UNLIMITED) {
+    this->bundleLpPacket(block, endpointId, static_cast<size_t>(mtu));
+  }
+  else {
+    this->sendPacket(block, endpointId);
+  }
+}
+
+void
+GenericLinkService::bundleLpPacket(const Block& block, const EndpointId& endpointId, size_t mtu)
+{
+  if (!m_bundle.empty() &&
+      (endpointId != m_bundleEndpoint || m_bundleSize + block.size() > mtu)) {
+    this->flushBundle();
+  }
+
+  if (m_bundle.empty()) {
+    m_bundleEndpoint = endpointId;
+    m_flushBundleTimer = getScheduler().schedule(m_options.bundlingDelay, [this] { flushBundle(); });
+  }
+  m_bundle.push_back(block);
+  m_bundleSize += block.size();
+}
+
+void
+GenericLinkService::flushBundle()
+{
+  m_flushBundleTimer.cancel();
+  if (m_bundle.empty()) {
+    return;
+  }
+
+  if (m_bundle.size() == 1) {
+    this->sendPacket(m_bundle.front(), m_bundleEndpoint);
+  }
+  else {
+    NFD_LOG_FACE_TRACE("sending " << m_bundle.size() << " LpPackets in one frame");
+    ndn::EncodingBuffer buffer(m_bundleSize, m_bundleSize);
+    for (const Block& block : m_bundle) {
+      buffer.appendByteArray(block.wire(), block.size());
+    }
+    // the frame is a Block whose wire spans all bundled LpPackets
+    this->sendPacket(buffer.block(false), m_bundleEndpoint);
+  }
+
+  m_bundle.clear();
+  m_bundleSize = 0;
 }
 
 void
 GenericLinkService::doSendInterest(const Interest& interest, const EndpointId& endpointId)
 {
-  lp::Packet lpPacket(interest.wireEncode());
+  lp::Packet lpPacket;
 
   encodeLpFields(interest, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), endpointId, true);
+  this->sendNetPacket(interest.wireEncode(), std::move(lpPacket), endpointId, true);
 }
 
 void
 GenericLinkService::doSendData(const Data& data, const EndpointId& endpointId)
 {
-  lp::Packet lpPacket(data.wireEncode());
+  lp::Packet lpPacket;
 
   encodeLpFields(data, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), endpointId, false);
+  this->sendNetPacket(data.wireEncode(), std::move(lpPacket), endpointId, false);
 }
 
 void
 GenericLinkService::doSendNack(const lp::Nack& nack, const EndpointId& endpointId)
 {
-  lp::Packet lpPacket(nack.getInterest().wireEncode());
+  lp::Packet lpPacket;
   lpPacket.add<lp::NackField>(nack.getHeader());
 
   encodeLpFields(nack, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), endpointId, false);
+  this->sendNetPacket(nack.getInterest().wireEncode(), std::move(lpPacket), endpointId, false);
 }
 
 void
@@ -157,11 +253,33 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
 }
 
 void
-GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest)
+GenericLinkService::sendNetPacket(const Block& netPkt, lp::Packet&& pkt,
+                                  const EndpointId& endpointId, bool isInterest)
 {
-  std::vector<lp::Packet> frags;
   ssize_t mtu = this->getTransport()->getMtu();
 
+  // fast path: without reliability, a packet that fits in the MTU needs neither fragmentation
+  // nor a sequence number, so the LpPacket is encoded directly around the network layer packet
+  if (!m_options.reliabilityOptions.isEnabled) {
+    size_t headerSize = pkt.empty() ? 0 : pkt.wireEncode().value_size();
+    if (m_options.allowCongestionMarking) {
+      headerSize += CONGESTION_MARK_SIZE;
+    }
+
+    if (mtu == MTU_UNLIMITED ||
+        computeLpPacketSize(headerSize, netPkt.size()) <= static_cast<size_t>(mtu)) {
+      if (m_options.allowCongestionMarking) {
+        checkCongestionLevel(pkt);
+      }
+      this->sendFrame(encodeLpPacket(netPkt, pkt), endpointId);
+      return;
+    }
+  }
+
+  pkt.add<lp::FragmentField>({netPkt.begin(), netPkt.end()});
+
+  std::vector<lp::Packet> frags;
+
   // Make space for feature fields in fragments
   if (m_options.reliabilityOptions.isEnabled && mtu != MTU_UNLIMITED) {
     mtu -= LpReliability::RESERVED_HEADER_SPACE;
@@ -228,24 +346,46 @@ GenericLinkService::assignSequences(std::vector<lp::Packet>& pkts)
 void
 GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
 {
-  ssize_t sendQueueLength = getTransport()->getSendQueueLength();
-  // The transport must support retrieving the current send queue length
-  if (sendQueueLength < 0) {
-    return;
+  time::nanoseconds markingInterval = m_options.baseCongestionMarkingInterval;
+  bool isAboveTarget = false;
+
+  time::nanoseconds sojournTime = getTransport()->getSendQueueSojournTime();
+  if (sojournTime != SOJOURN_TIME_UNSUPPORTED) {
+    time::nanoseconds target = m_options.congestionSojournTarget;
+    ssize_t mtu = getTransport()->getMtu();
+    if (mtu != MTU_UNLIMITED) {
+      // a queue holding a single MTU-sized packet is not a standing queue
+      target = std::max(target, getTransport()->getTimeOnAir(static_cast<size_t>(mtu)));
+    }
+    markingInterval = std::max(markingInterval, SOJOURN_INTERVAL_TO_TARGET_RATIO * target);
+
+    if (sojournTime > 0_ns) {
+      NFD_LOG_FACE_TRACE("sojourn=" << sojournTime << " target=" << target <<
+                         " interval=" << markingInterval);
+    }
+    isAboveTarget = sojournTime > target;
   }
+  else {
+    ssize_t sendQueueLength = getTransport()->getSendQueueLength();
+    // The transport must support retrieving the current send queue length
+    if (sendQueueLength < 0) {
+      return;
+    }
 
-  if (sendQueueLength > 0) {
-    NFD_LOG_FACE_TRACE("txqlen=" << sendQueueLength << " threshold=" <<
-                       m_options.defaultCongestionThreshold << " capacity=" <<
-                       getTransport()->getSendQueueCapacity());
+    if (sendQueueLength > 0) {
+      NFD_LOG_FACE_TRACE("txqlen=" << sendQueueLength << " threshold=" <<
+                         m_options.defaultCongestionThreshold << " capacity=" <<
+                         getTransport()->getSendQueueCapacity());
+    }
+    isAboveTarget = static_cast<size_t>(sendQueueLength) > m_options.defaultCongestionThreshold;
   }
 
   // sendQueue is above target
-  if (static_cast<size_t>(sendQueueLength) > m_options.defaultCongestionThreshold) {
+  if (isAboveTarget) {
     const auto now = time::steady_clock::now();
 
     if (m_nextMarkTime == time::steady_clock::TimePoint::max()) {
-      m_nextMarkTime = now + m_options.baseCongestionMarkingInterval;
+      m_nextMarkTime = now + markingInterval;
     }
     // Mark packet if sendQueue stays above target for one interval
     else if (now >= m_nextMarkTime) {
@@ -257,14 +397,14 @@ GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
       // Decrease the marking interval by the inverse of the square root of the number of packets
       // marked in this incident of congestion
       time::nanoseconds interval(static_cast<time::nanoseconds::rep>(
-                                   m_options.baseCongestionMarkingInterval.count() /
+                                   markingInterval.count() /
                                    std::sqrt(m_nMarkedSinceInMarkingState + 1)));
       m_nextMarkTime += interval;
     }
   }
   else if (m_nextMarkTime != time::steady_clock::TimePoint::max()) {
     // Congestion incident has ended, so reset
-    NFD_LOG_FACE_DEBUG("Send queue length dropped below congestion threshold");
+    NFD_LOG_FACE_DEBUG("Send queue dropped below congestion target");
     m_nextMarkTime = time::steady_clock::TimePoint::max();
     m_nMarkedSinceInMarkingState = 0;
   }
@@ -441,6 +581,15 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
     }
   }
 
+  if (firstPkt.has<lp::PitTokenField>()) {
+    if (m_options.allowPitToken) {
+      data->setTag(make_shared<lp::PitToken>(firstPkt.get<lp::PitTokenField>()));
+    }
+    else {
+      NFD_LOG_FACE_WARN("received PitToken with Data, but PIT tokens disabled: IGNORE");
+    }
+  }
+
   this->receiveData(*data, endpointId);
 }
 
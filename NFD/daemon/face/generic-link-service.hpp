@@ -81,6 +81,11 @@ public:
    */
   PacketCounter nRetxExhausted;
 
+  /** \brief count of retransmitted fragments whose earlier transmission was acknowledged,
+   *         i.e., the retransmission was unnecessary
+   */
+  PacketCounter nSpuriousRetx;
+
   /** \brief count of outgoing LpPackets that were marked with congestion marks
    */
   PacketCounter nCongestionMarked;
@@ -148,9 +153,41 @@ public:
      */
     size_t defaultCongestionThreshold = 65536;
 
+    /** \brief target sojourn time of the send queue
+     *
+     *  If the transport supports measuring the sojourn time of its send queue, packets are marked
+     *  if the sojourn time stays above TARGET for at least one INTERVAL, and the queue length is
+     *  not considered.
+     *
+     *  The default value (5 ms) is taken from RFC 8289 (CoDel). If the transport models time-on-air,
+     *  TARGET is raised to the time-on-air of an MTU-sized packet. In either case, INTERVAL is
+     *  raised to at least 20 times TARGET, as RFC 8289 recommends a TARGET of 5-10% of INTERVAL.
+     */
+    time::nanoseconds congestionSojournTarget = 5_ms;
+
+    /** \brief enables bundling of several LpPackets into one transport frame
+     *
+     *  LpPackets sent within bundlingDelay after the first one of a bundle are concatenated into
+     *  a single frame, as long as the frame fits in the MTU. The receiving transport delivers each
+     *  LpPacket in the frame separately. Bundling has no effect if the MTU is unlimited.
+     */
+    bool allowBundling = false;
+
+    /** \brief maximum time an LpPacket is held back to be bundled with subsequent LpPackets
+     */
+    time::nanoseconds bundlingDelay = 1_ms;
+
     /** \brief enables self-learning forwarding support
      */
     bool allowSelfLearning = true;
+
+    /** \brief enables PIT tokens issued by the forwarder on outgoing Interests
+     *
+     *  The remote endpoint must return the PIT token of an Interest in the Data that satisfies
+     *  it, which allows the forwarder to find the PIT entry without a name lookup. PIT tokens
+     *  in incoming Data are ignored unless this option is enabled.
+     */
+    bool allowPitToken = false;
   };
 
   /** \brief counters provided by GenericLinkService
@@ -173,6 +210,9 @@ public:
   const Counters&
   getCounters() const OVERRIDE_WITH_TESTS_ELSE_FINAL;
 
+  bool
+  allowsPitToken() const OVERRIDE_WITH_TESTS_ELSE_FINAL;
+
 PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
   /** \brief request an IDLE packet to transmit pending service fields
    */
@@ -208,12 +248,22 @@ private: // send path
   encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
 
   /** \brief send a complete network layer packet
-   *  \param pkt LpPacket containing a complete network layer packet
+   *  \param netPkt encoded network layer packet
+   *  \param pkt LpPacket containing the header fields to send with the network layer packet
    *  \param endpointId destination endpoint to which LpPacket will be sent
    *  \param isInterest whether the network layer packet is an Interest
+   *
+   *  If reliability is disabled and the LpPacket fits in the MTU, it is encoded directly around
+   *  \p netPkt, or \p netPkt itself is sent if there are no header fields; otherwise, the LpPacket
+   *  goes through fragmentation and reliability.
    */
   void
-  sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest);
+  sendNetPacket(const Block& netPkt, lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest);
+
+  /** \brief send an encoded LpPacket to \p endpointId, bundling it if enabled
+   */
+  void
+  sendFrame(const Block& block, const EndpointId& endpointId);
 
   /** \brief assign a sequence number to an LpPacket
    */
@@ -226,12 +276,27 @@ private: // send path
   assignSequences(std::vector<lp::Packet>& pkts);
 
   /** \brief if the send queue is found to be congested, add a congestion mark to the packet
-   *         according to CoDel
+   *
+   *  The send queue is considered congested when its sojourn time, or its length if the
+   *  transport cannot report sojourn time, stays above the target for at least one marking
+   *  interval. While the queue remains congested, packets are marked at intervals that shrink
+   *  with the square root of the number of marks, according to CoDel.
    *  \sa https://tools.ietf.org/html/rfc8289
    */
   void
   checkCongestionLevel(lp::Packet& pkt);
 
+  /** \brief append an encoded LpPacket to the pending bundle, sending the bundle first if the
+   *         LpPacket does not fit in it or goes to another endpoint
+   */
+  void
+  bundleLpPacket(const Block& block, const EndpointId& endpointId, size_t mtu);
+
+  /** \brief send the pending bundle, if any, as a single frame
+   */
+  void
+  flushBundle();
+
 private: // receive path
   /** \brief receive Packet from Transport
    */
@@ -301,6 +366,16 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /// number of marked packets in the current incident of congestion
   size_t m_nMarkedSinceInMarkingState;
 
+PROTECTED_WITH_TESTS_ELSE_PRIVATE:
+  /// encoded LpPackets waiting to be sent in the same frame
+  std::vector<Block> m_bundle;
+  /// total size of the LpPackets in m_bundle
+  size_t m_bundleSize = 0;
+  /// endpoint to which the pending bundle is sent
+  EndpointId m_bundleEndpoint = 0;
+  /// sends the pending bundle after bundlingDelay
+  scheduler::ScopedEventId m_flushBundleTimer;
+
   friend class LpReliability;
 };
 
@@ -316,6 +391,12 @@ GenericLinkService::getCounters() const
   return *this;
 }
 
+inline bool
+GenericLinkService::allowsPitToken() const
+{
+  return m_options.allowPitToken;
+}
+
 } // namespace face
 } // namespace nfd
 
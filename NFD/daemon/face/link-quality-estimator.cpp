@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "link-quality-estimator.hpp"
+
+#include <cmath>
+
+namespace nfd {
+namespace face {
+
+constexpr double LinkQualityEstimator::ALPHA;
+constexpr double LinkQualityEstimator::MIN_DELIVERY_RATIO;
+
+static void
+addSample(optional<double>& average, double sample)
+{
+  if (average) {
+    *average += LinkQualityEstimator::ALPHA * (sample - *average);
+  }
+  else {
+    average = sample;
+  }
+}
+
+void
+LinkQualityEstimator::addTransmissionOutcome(bool isAcknowledged)
+{
+  addSample(m_ackRatio, isAcknowledged ? 1.0 : 0.0);
+}
+
+void
+LinkQualityEstimator::addReceptions(size_t nReceived, size_t nMissed)
+{
+  if (nReceived + nMissed == 0) {
+    return;
+  }
+
+  if (!m_reverseDeliveryRatio) {
+    m_reverseDeliveryRatio = static_cast<double>(nReceived) / (nReceived + nMissed);
+    return;
+  }
+
+  // equivalent to adding nMissed zero samples followed by nReceived one samples
+  double& ratio = *m_reverseDeliveryRatio;
+  ratio *= std::pow(1.0 - ALPHA, nMissed);
+  ratio = 1.0 - (1.0 - ratio) * std::pow(1.0 - ALPHA, nReceived);
+}
+
+void
+LinkQualityEstimator::addSignalSample(double rssi, double snr)
+{
+  addSample(m_rssi, rssi);
+  addSample(m_snr, snr);
+}
+
+void
+LinkQualityEstimator::addTransmission(size_t nOctets, time::nanoseconds airtime)
+{
+  if (nOctets == 0) {
+    return;
+  }
+  addSample(m_airtimePerOctet, static_cast<double>(airtime.count()) / nOctets);
+}
+
+double
+LinkQualityEstimator::getEtx() const
+{
+  if (m_ackRatio) {
+    return 1.0 / std::max(*m_ackRatio, MIN_DELIVERY_RATIO * MIN_DELIVERY_RATIO);
+  }
+  if (m_reverseDeliveryRatio) {
+    double ratio = std::max(*m_reverseDeliveryRatio, MIN_DELIVERY_RATIO);
+    return 1.0 / (ratio * ratio);
+  }
+  return 1.0;
+}
+
+time::nanoseconds
+LinkQualityEstimator::getAirtimePerDeliveredOctet() const
+{
+  if (!m_airtimePerOctet) {
+    return 0_ns;
+  }
+  return time::nanoseconds(static_cast<time::nanoseconds::rep>(*m_airtimePerOctet * getEtx()));
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_LINK_QUALITY_ESTIMATOR_HPP
+#define NFD_DAEMON_FACE_LINK_QUALITY_ESTIMATOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace face {
+
+/** \brief estimates the quality of the link between a transport and its remote endpoint
+ *
+ *  The estimator is fed by the link layer: the transport reports signal quality and
+ *  sequence gaps of received frames and the airtime of sent frames, and the reliability
+ *  layer reports whether each transmitted frame was acknowledged.
+ *  All estimates are exponentially weighted moving averages.
+ */
+class LinkQualityEstimator
+{
+public:
+  /** \brief records the outcome of a transmission that requested an acknowledgement
+   *  \param isAcknowledged whether the acknowledgement was received
+   *
+   *  An acknowledged transmission has succeeded in both directions of the link.
+   */
+  void
+  addTransmissionOutcome(bool isAcknowledged);
+
+  /** \brief records frames received from the remote endpoint in the reverse direction
+   *  \param nReceived number of frames received
+   *  \param nMissed number of frames the remote endpoint sent but were not received,
+   *                 as inferred from gaps in link-layer sequence numbers
+   */
+  void
+  addReceptions(size_t nReceived, size_t nMissed);
+
+  /** \brief records the signal quality of a frame received from the remote endpoint
+   *  \param rssi received signal strength, in dBm
+   *  \param snr signal-to-noise ratio, in dB
+   */
+  void
+  addSignalSample(double rssi, double snr);
+
+  /** \brief records a frame sent to the remote endpoint
+   *  \param nOctets size of the frame
+   *  \param airtime time taken to transmit the frame on the medium
+   */
+  void
+  addTransmission(size_t nOctets, time::nanoseconds airtime);
+
+  /** \return Expected Transmission Count, the expected number of transmissions needed to
+   *          deliver a frame and receive its acknowledgement
+   *  \retval 1.0 link is lossless or has not been measured
+   *
+   *  The ETX is derived from the acknowledgement ratio if transmissions have requested
+   *  acknowledgements. Otherwise, it is derived from the reverse delivery ratio, assuming
+   *  the link is symmetric.
+   */
+  double
+  getEtx() const;
+
+  /** \return smoothed RSSI of received frames, in dBm
+   */
+  optional<double>
+  getRssi() const
+  {
+    return m_rssi;
+  }
+
+  /** \return smoothed SNR of received frames, in dB
+   */
+  optional<double>
+  getSnr() const
+  {
+    return m_snr;
+  }
+
+  /** \return expected airtime spent on the medium per octet delivered to the remote endpoint,
+   *          including retransmissions
+   *  \retval time::nanoseconds::zero() transport does not report airtime
+   */
+  time::nanoseconds
+  getAirtimePerDeliveredOctet() const;
+
+public:
+  /** \brief weight of a new sample in the moving averages
+   */
+  static constexpr double ALPHA = 1.0 / 8;
+
+  /** \brief lower bound of delivery ratios, which limits the ETX of a dead link
+   */
+  static constexpr double MIN_DELIVERY_RATIO = 0.01;
+
+private:
+  optional<double> m_ackRatio;
+  optional<double> m_reverseDeliveryRatio;
+  optional<double> m_rssi;
+  optional<double> m_snr;
+  optional<double> m_airtimePerOctet; // in nanoseconds
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_LINK_QUALITY_ESTIMATOR_HPP
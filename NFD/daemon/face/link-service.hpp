@@ -109,6 +109,17 @@ public:
   virtual const Counters&
   getCounters() const;
 
+  /** \return whether the forwarder may attach its own PIT tokens to Interests sent on this link
+   *
+   *  The remote endpoint is expected to return the PIT token in the Data that satisfies
+   *  the Interest.
+   */
+  virtual bool
+  allowsPitToken() const
+  {
+    return false;
+  }
+
 public: // upper interface to be used by forwarding
   /** \brief Send Interest to \p endpoint
    *  \pre setTransport has been called
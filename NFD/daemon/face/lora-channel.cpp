@@ -34,38 +34,73 @@ namespace face {
 
 NFD_LOG_INIT(LoRaChannel);
 
-LoRaChannel::LoRaChannel(std::string URI){
+LoRaChannel::LoRaChannel(std::string URI, std::function<void()> onEmpty)
+  : m_onEmpty(std::move(onEmpty)) {
   setUri(ndn::FaceUri(URI));
   NFD_LOG_CHAN_INFO("Creating channel");
 }
 
 
 void
-LoRaChannel::createFace(std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*>* sendBufferQueue,
+LoRaChannel::createFace(LoRaSendQueue* sendBufferQueue,
                         pthread_mutex_t* queueMutex,
+                        const LoRaModulation& modulation,
                         std::pair<uint8_t, uint8_t> ids,
+                        const FaceUri& localUri,
                         const FaceParams& params,
                         const FaceCreatedCallback& onFaceCreated,
                         const FaceCreationFailedCallback& onFailure)
 {
+  auto it = std::find_if(m_channelFaces.begin(), m_channelFaces.end(),
+                         [&localUri] (const auto& other) { return other->getLocalUri() == localUri; });
+  if (it != m_channelFaces.end()) {
+    // we already have a face for this profile, so reuse it
+    NFD_LOG_CHAN_TRACE("Face for " << localUri << " already exists");
+    onFaceCreated(*it);
+    return;
+  }
+
   try
   {
-    NFD_LOG_CHAN_INFO("Creating face");
+    NFD_LOG_CHAN_INFO("Creating face for " << localUri);
     std::shared_ptr<Face> face;
+    // Create the transport alyer associated with this channel
+    auto transport = make_unique<LoRaTransport>(ids, localUri, getUri(), sendBufferQueue, queueMutex, modulation);
+
     // Create the link service (we want to include fragmentation)
     GenericLinkService::Options options;
     options.allowFragmentation = true;
     options.allowReassembly = true;
     options.reliabilityOptions.isEnabled = params.wantLpReliability;
+    // Limit retransmissions by airtime, allowing as much as 3 retransmissions of a full-sized frame
+    options.reliabilityOptions.maxRetxAirtime = 3 * transport->getTimeOnAir(transport->getMtu());
+    // The radio queue drains slowly, so mark congestion by its sojourn time unless told otherwise
+    options.allowCongestionMarking = boost::logic::indeterminate(params.wantCongestionMarking) ||
+                                     bool(params.wantCongestionMarking);
+    if (params.baseCongestionMarkingInterval) {
+      options.baseCongestionMarkingInterval = *params.baseCongestionMarkingInterval;
+    }
+    // Every frame costs a preamble and header on the air, so it is worth waiting about as long
+    // as an empty frame takes to send small packets together
+    options.allowBundling = true;
+    options.bundlingDelay = transport->getTimeOnAir(0);
+    // A PIT token spares a name lookup per Data, but costs airtime on every Interest and Data
+    options.allowPitToken = params.wantPitToken;
     auto linkService = make_unique<GenericLinkService>(options);
 
-    // Create the transport alyer associated with this channel
-    auto transport = make_unique<LoRaTransport>(ids, sendBufferQueue, queueMutex);
-
-    // Create the face with this link service and transport layer (default face since each
-    // channel will just have 1 face, due to their only being 1 protocol for LoRa)
+    // Create the face with this link service and transport layer
     face = make_shared<Face>(std::move(linkService), std::move(transport));
-    m_channelFaces["default"] = face;
+    m_channelFaces.push_back(face);
+    connectFaceClosedSignal(*face, [this, f = face.get()] {
+      m_channelFaces.erase(std::remove_if(m_channelFaces.begin(), m_channelFaces.end(),
+                                          [f] (const auto& other) { return other.get() == f; }),
+                           m_channelFaces.end());
+      if (m_channelFaces.empty() && m_onEmpty) {
+        // the callback may destroy this channel
+        auto onEmpty = m_onEmpty;
+        onEmpty();
+      }
+    });
     // Created successfully
     onFaceCreated(face);
   }
@@ -79,8 +114,18 @@ LoRaChannel::createFace(std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::
 
 void
 LoRaChannel::handleReceive(ndn::Block data){
-  auto it = m_channelFaces.find("default");   // Change this if there multiple faces to a channel for lora
-  static_cast<LoRaTransport*>(it->second->getTransport())->receiveData(data);
+  if (m_channelFaces.empty()) {
+    return;
+  }
+  static_cast<LoRaTransport*>(m_channelFaces.front()->getTransport())->receiveData(data);
+}
+
+void
+LoRaChannel::handleReception(int rssi, int snr, size_t nMissedFrames){
+  // Every face of the channel uses the same radio link
+  for (const auto& face : m_channelFaces) {
+    static_cast<LoRaTransport*>(face->getTransport())->recordReception(rssi, snr, nMissedFrames);
+  }
 }
 
 }
@@ -27,7 +27,7 @@
 #define NFD_DAEMON_FACE_LORA_CHANNEL_HPP
 
 #include "channel.hpp"
-#include <queue>
+#include "lora-transport.hpp"
 #include <pthread.h>
 
  namespace nfd {
@@ -52,12 +52,24 @@ public:
     }
   };
 
-  LoRaChannel(std::string URI);
-
+  /**
+   * \param URI remote URI of the faces of this channel
+   * \param onEmpty callback invoked when the last face of this channel has been closed
+   */
+  LoRaChannel(std::string URI, std::function<void()> onEmpty);
+
+  /**
+   * \brief Creates a face on this channel, or returns the existing face with the same local URI
+   *
+   * A channel can have several faces to the same neighbor (e.g., with different
+   * persistency or link service settings), which are told apart by their local URIs.
+   */
   void
-  createFace( std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*>* sendBufferQueue,
+  createFace( LoRaSendQueue* sendBufferQueue,
               pthread_mutex_t* queueMutex,
+              const LoRaModulation& modulation,
               std::pair<uint8_t, uint8_t> ids,
+              const FaceUri& localUri,
               const FaceParams& params,
               const FaceCreatedCallback& onFaceCreated,
               const FaceCreationFailedCallback& onFailure);
@@ -71,15 +83,28 @@ public:
   size_t
   size() const override
   {
-    return m_size;
+    return m_channelFaces.size();
   }
 
+  /**
+   * \brief Passes a received packet to the face of this channel that was created first
+   *
+   * Frames do not identify which face of the neighbor sent them, so the other faces
+   * of the channel only send.
+   */
   void
   handleReceive(ndn::Block);
 
+  /**
+   * \brief Updates the link quality of the face with a frame received from its neighbor
+   */
+  void
+  handleReception(int rssi, int snr, size_t nMissedFrames);
+
 private:
-  std::map<std::string, shared_ptr<Face>> m_channelFaces;
-  size_t m_size;
+  // Faces of this channel, in creation order
+  std::vector<shared_ptr<Face>> m_channelFaces;
+  std::function<void()> m_onEmpty;
 
 };
 
@@ -10,6 +10,10 @@ namespace face {
 NFD_LOG_INIT(LoRaFactory);
 NFD_REGISTER_PROTOCOL_FACTORY(LoRaFactory);
 
+// A larger gap between packet numbers more likely means that the neighbor restarted, or that
+// the radio library repeated a frame, than that so many frames were lost
+constexpr uint8_t MAX_PACKET_NUMBER_GAP = 64;
+
 
 const std::string&
 LoRaFactory::getId() noexcept
@@ -38,7 +42,31 @@ void
 LoRaFactory::doProcessConfig(OptionalConfigSection configSection,
                             FaceSystem::ConfigContext& context)
 {
-    // Not implemented yet! Implement if time
+  // lora
+  // {
+  //   pit_token no
+  // }
+
+  bool wantPitToken = false;
+
+  if (configSection) {
+    for (const auto& pair : *configSection) {
+      const std::string& key = pair.first;
+
+      if (key == "pit_token") {
+        wantPitToken = ConfigFile::parseYesNo(pair, "face_system.lora");
+      }
+      else {
+        NDN_THROW(ConfigFile::Error("Unrecognized option face_system.lora." + key));
+      }
+    }
+  }
+
+  if (context.isDryRun) {
+    return;
+  }
+
+  m_wantPitToken = wantPitToken;
 }
 
 void
@@ -47,26 +75,12 @@ LoRaFactory::doCreateFace(const CreateFaceRequest& req,
                          const FaceCreationFailedCallback& onFailure)
 {
   std::string URI = req.remoteUri.toString();
+  FaceParams params = req.params;
+  params.wantPitToken = m_wantPitToken;
   try
   { 
-      std::map<std::string, std::shared_ptr<LoRaChannel>> channels;
-      // unicast
-      if (URI.find('-') != std::string::npos) {
-        channels = m_channels;
-      }
-      else {
-        channels = mcast_channels;
-      }
-      for (const auto& i : channels) {
-        // Found a channel already created
-        if (i.first == req.remoteUri.toString()) {
-          const std::string retStr = "Face already exists for " + URI;
-          onFailure(504, retStr);
-          return;
-        }
-      }
-
-      // Otherwise create a channel for this new request and a face associated with it (either unicast or multicast)
+      // Create a channel for this request if needed, and a face associated with it (either unicast or multicast).
+      // The channel creates another face to the same remote if the local URI differs from its existing faces.
       // If the URI contains a '-', we know its a unicast face
       size_t hyphenPosition = URI.find('-');
       if (hyphenPosition != std::string::npos) {
@@ -74,16 +88,18 @@ LoRaFactory::doCreateFace(const CreateFaceRequest& req,
         uint8_t id = std::stoi(URI.substr(numberOfCharsInScheme, hyphenPosition - numberOfCharsInScheme));
         uint8_t connID = std::stoi(URI.substr(hyphenPosition+1));
         std::pair<uint8_t, uint8_t> sendIDAndConnID = std::make_pair(id, connID);
+        FaceUri localUri = req.localUri ? *req.localUri : FaceUri("lora://" + std::to_string(id));
         NFD_LOG_INFO("id: " << std::to_string(id) << " connID: " << std::to_string(connID));
-        channel->createFace(&sendBufferQueue, &threadLock, sendIDAndConnID, req.params, onCreated, onFailure);
+        channel->createFace(&sendBufferQueue, &threadLock, m_modulation, sendIDAndConnID, localUri, params, onCreated, onFailure);
       }
       // Otherwise its a multicast face (broadcast)
       else {
         auto channel = createMultiCastChannel(URI);
         uint8_t id = std::stoi(URI.substr(numberOfCharsInScheme));
         std::pair<uint8_t, uint8_t> sendIDAndConnID = std::make_pair(id, BROADCAST_0);
+        FaceUri localUri = req.localUri ? *req.localUri : req.remoteUri;
         NFD_LOG_INFO("id: " << std::to_string(id) << " connID: " << std::to_string(BROADCAST_0));
-        channel->createFace(&sendBufferQueue, &threadLock, sendIDAndConnID, req.params, onCreated, onFailure);
+        channel->createFace(&sendBufferQueue, &threadLock, m_modulation, sendIDAndConnID, localUri, params, onCreated, onFailure);
       }
 
   }
@@ -99,7 +115,8 @@ LoRaFactory::createMultiCastChannel(std::string URI) {
   if (it != mcast_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<LoRaChannel>(URI);
+  // Forget the channel when its last face is closed, so that it no longer receives frames
+  auto channel = std::make_shared<LoRaChannel>(URI, [this, URI] { mcast_channels.erase(URI); });
   mcast_channels[URI] = channel;
   return channel;
 }
@@ -111,7 +128,8 @@ LoRaFactory::createChannel(std::string URI)
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<LoRaChannel>(URI);
+  // Forget the channel when its last face is closed, so that it no longer receives frames
+  auto channel = std::make_shared<LoRaChannel>(URI, [this, URI] { m_channels.erase(URI); });
   m_channels[URI] = channel;
   return channel;
 }
@@ -129,6 +147,7 @@ LoRaFactory::setup(){
   e = sx1272.ON();
   
   //Set Operating Parameters Coding Rate CR, Bandwidth BW, and Spreading Factor SF
+  //(must match m_modulation, which is used to compute time-on-air)
   e = sx1272.setCR(CR_5);
   e = sx1272.setBW(BW_500);
   e = sx1272.setSF(SF_7);
@@ -170,13 +189,17 @@ void *LoRaFactory::transmit_and_recieve()
         // sendBufferQueue shared resouce
         pthread_mutex_lock(&threadLock);
 
-        // Check and see if there is something to send
-        bool toSend = sendBufferQueue.size() > 0;
-        if (toSend) {
-          while(toSend) {
-            sendPacket();
-            sendBufferQueue.pop();
-            toSend = sendBufferQueue.empty() == false;
+        // Check and see if there is something to send (deferred broadcast frames wait for their turn)
+        auto toSend = findReadyFrame(sendBufferQueue, time::steady_clock::now());
+        if (toSend != sendBufferQueue.end()) {
+          while(toSend != sendBufferQueue.end()) {
+            // Release the queue while transmitting so faces can keep enqueuing frames
+            LoRaFrame frame = std::move(*toSend);
+            sendBufferQueue.erase(toSend);
+            pthread_mutex_unlock(&threadLock);
+            sendPacket(frame);
+            pthread_mutex_lock(&threadLock);
+            toSend = findReadyFrame(sendBufferQueue, time::steady_clock::now());
           }
 
           // After sending enter recieve mode again
@@ -203,55 +226,27 @@ void *LoRaFactory::transmit_and_recieve()
 }
 
 void
-LoRaFactory::sendPacket()
+LoRaFactory::sendPacket(LoRaFrame& frame)
 {
   try
   {
-      // Grab queue item
-      std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>* queueElement = sendBufferQueue.front();
-      if (queueElement == nullptr) {
-        NFD_LOG_ERROR("Passed a null queue item to send, not sending");
-        return;
-      }
-
-      // Grab encoding to send from queue item
-      sendBuffer = queueElement->second;
-      if (sendBuffer == nullptr) {
-        NFD_LOG_ERROR("Passed a null encoding to send, not sending");
-        return;
-      }
-
       // Check the size of the encoding
-      int bufSize = sendBuffer->size();
+      int bufSize = frame.payload.size();
       if (bufSize <= 0) {
         NFD_LOG_ERROR("Trying to send a packet with no size");
         return;
       }
 
-      // copy the buffer into a cstr so we can send it
-      char *cstr = new char[bufSize];
-      int i = 0;
-      for (auto ptr : *sendBuffer) {
-        cstr[i++] = ptr;
-      }
-
-      // Now grab src and dst IDs from queue item
-      std::pair<uint8_t, uint8_t>* ids = queueElement->first;
-      if (ids == nullptr) {
-        NFD_LOG_ERROR("Passed a null pair of ids, not sending");
-        return;
-      }
-
       // Grad source and dst IDs
-      uint8_t dst = ids->second;
-      uint8_t id = ids->first;
+      uint8_t dst = frame.dst;
+      uint8_t id = frame.src;
       
       // Set LoRa source to ID
       if ((e = sx1272.setNodeAddress(id)) != 0) {
         NFD_LOG_ERROR("Unable to set src ID to " << std::to_string(id));
       }
 
-      if ((e = sx1272.sendPacketTimeout(dst, cstr, bufSize)) != 0)
+      if ((e = sx1272.sendPacketTimeout(dst, reinterpret_cast<char*>(frame.payload.data()), bufSize)) != 0)
       {
         NFD_LOG_ERROR("Send operation failed: " + std::to_string(e));
       }
@@ -268,11 +263,6 @@ LoRaFactory::sendPacket()
         }  
         NFD_LOG_INFO(info);
       }
-
-      // Have to free all of queue data
-      delete[] cstr;
-      delete sendBuffer; 
-      delete ids;
   }
   catch(const std::exception& e)
   {
@@ -281,6 +271,21 @@ LoRaFactory::sendPacket()
   
 }
 
+size_t
+LoRaFactory::countMissedFrames(uint8_t src, uint8_t packetNumber)
+{
+  auto it = m_lastPacketNumbers.find(src);
+  if (it == m_lastPacketNumbers.end()) {
+    m_lastPacketNumbers.emplace(src, packetNumber);
+    return 0;
+  }
+
+  // Packet numbers are incremented by the sender for every frame it transmits, and wrap around
+  uint8_t gap = static_cast<uint8_t>(packetNumber - it->second - 1);
+  it->second = packetNumber;
+  return gap <= MAX_PACKET_NUMBER_GAP ? gap : 0;
+}
+
 void
 LoRaFactory::handleRead() {
   
@@ -315,26 +320,65 @@ LoRaFactory::handleRead() {
     return;
   }
 
-  try
-  {
-    ndn::Block element = ndn::Block((uint8_t*)my_packet, i);
-    // See what unicast faces want this data
+  auto frame = make_shared<LoRaReceivedFrame>();
+  frame->src = sx1272.packet_received.src;
+  frame->dst = sx1272.packet_received.dst;
+  frame->payload = ndn::Buffer(my_packet, i);
+  frame->nMissedFrames = countMissedFrames(frame->src, sx1272.packet_received.packnum);
+  frame->hasSignal = sx1272.getRSSIpacket() == 0;
+  frame->rssi = sx1272._RSSIpacket;
+  frame->snr = sx1272._SNR;
+
+  // Channels and faces are created and closed on the main thread, so dispatch the frame there
+  runOnMainIoService([this, frame] { dispatchFrame(*frame); });
+}
+
+void
+LoRaFactory::dispatchFrame(const LoRaReceivedFrame& frame) {
+  // Every frame heard from a neighbor, even if addressed to another node, tells about the link to it
+  if (frame.hasSignal) {
     for (const auto& i : m_channels) {
       std::size_t position = i.first.find('-');
-      // Check to see if the connection ID matches src, if it does pass the data to this face. Also if ID matches
-      // lora://<id>-<connID>
-      std::string idString = i.first.substr(numberOfCharsInScheme, position - numberOfCharsInScheme);
-      std::string connIDString = i.first.substr(position+1);
-      if (std::stoi(connIDString) == sx1272.packet_received.src && (std::stoi(idString) == sx1272.packet_received.dst || sx1272.packet_received.dst == BROADCAST_0)) {
-        i.second->handleReceive(element);
+      if (std::stoi(i.first.substr(position+1)) == frame.src) {
+        i.second->handleReception(frame.rssi, frame.snr, frame.nMissedFrames);
       }
     }
-    // Pass to all broadcast channels with the right source
-    // lora://<id>
-    for (const auto& i : mcast_channels) {
-      std::string idString = i.first.substr(numberOfCharsInScheme);
-      if (std::stoi(idString) == sx1272.packet_received.dst || sx1272.packet_received.dst == BROADCAST_0) {
-        i.second->handleReceive(element);
+  }
+
+  try
+  {
+    // A frame may carry several packets bundled by the sender
+    size_t offset = 0;
+    while (offset < frame.payload.size()) {
+      ndn::Block element = ndn::Block(frame.payload.data() + offset, frame.payload.size() - offset);
+      offset += element.size();
+
+      // A neighbor already transmitted this packet, so there is no need for us to send it again
+      pthread_mutex_lock(&threadLock);
+      size_t nCancelled = cancelOverheardFrames(sendBufferQueue, element);
+      pthread_mutex_unlock(&threadLock);
+      if (nCancelled > 0) {
+        NFD_LOG_INFO("Cancelled " << nCancelled << " queued frame(s) after overhearing the same packet");
+      }
+
+      // See what unicast faces want this data
+      for (const auto& i : m_channels) {
+        std::size_t position = i.first.find('-');
+        // Check to see if the connection ID matches src, if it does pass the data to this face. Also if ID matches
+        // lora://<id>-<connID>
+        std::string idString = i.first.substr(numberOfCharsInScheme, position - numberOfCharsInScheme);
+        std::string connIDString = i.first.substr(position+1);
+        if (std::stoi(connIDString) == frame.src && (std::stoi(idString) == frame.dst || frame.dst == BROADCAST_0)) {
+          i.second->handleReceive(element);
+        }
+      }
+      // Pass to all broadcast channels with the right source
+      // lora://<id>
+      for (const auto& i : mcast_channels) {
+        std::string idString = i.first.substr(numberOfCharsInScheme);
+        if (std::stoi(idString) == frame.dst || frame.dst == BROADCAST_0) {
+          i.second->handleReceive(element);
+        }
       }
     }
     NFD_LOG_INFO("Created block succesfully and called receive");
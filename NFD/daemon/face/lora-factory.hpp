@@ -8,6 +8,22 @@
 namespace nfd {
 namespace face {
 
+/**
+ * @brief A frame received by the radio, waiting to be dispatched to faces
+ */
+struct LoRaReceivedFrame
+{
+  uint8_t src;
+  uint8_t dst;
+  ndn::Buffer payload;
+  /// number of frames from the same sender that were missed before this one
+  size_t nMissedFrames;
+  /// whether rssi and snr could be read from the radio
+  bool hasSignal;
+  int rssi;
+  int snr;
+};
+
 class LoRaFactory : public ProtocolFactory
 {
 public:
@@ -75,17 +91,30 @@ private:
   doGetChannels() const override;
 
   /**
-   * @brief Sends the specified TLV block on the network wrapped in an Ethernet frame
+   * @brief Sends the specified frame on the radio
    */
   void
-  sendPacket();
-  
+  sendPacket(LoRaFrame& frame);
+
+  /**
+   * @brief Returns how many frames from @p src were missed before the frame numbered @p packetNumber
+   */
+  size_t
+  countMissedFrames(uint8_t src, uint8_t packetNumber);
+
   /**
    * Handle incoming data received on the lora module 
   */
   void
   handleRead();
 
+  /**
+   * @brief Passes a frame received by the radio to the faces it is addressed to
+   * @note Runs on the main thread
+   */
+  void
+  dispatchFrame(const LoRaReceivedFrame& frame);
+
 private:
   // scheme is lora://
   const int numberOfCharsInScheme = 7;
@@ -112,8 +141,16 @@ private:
   pthread_mutex_t threadLock = PTHREAD_MUTEX_INITIALIZER; 
 
   // Queue used to send messages out through LoRa
-  std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*> sendBufferQueue;
-  ndn::encoding::EncodingBuffer *sendBuffer;
+  LoRaSendQueue sendBufferQueue;
+
+  // Modulation settings applied to the radio in setup()
+  LoRaModulation m_modulation;
+
+  // Packet number of the last frame heard from each neighbor, used to detect losses
+  std::map<uint8_t, uint8_t> m_lastPacketNumbers;
+
+  // Whether new faces attach PIT tokens to the Interests they send (face_system.lora.pit_token)
+  bool m_wantPitToken = false;
 
 };
 
@@ -3,19 +3,108 @@
  */
 
 #include "lora-transport.hpp"
+#include "common/city-hash.hpp"
+#include "../../lora_libs/libraries/arduPiLoRa/arduPiLoRa.h"
+
+#include <ndn-cxx/lp/packet.hpp>
+#include <ndn-cxx/util/random.hpp>
+
+#include <cmath>
+
 namespace nfd {
 
 namespace face {
 
 NFD_LOG_INIT(LoRaTransport);
 
+time::nanoseconds
+LoRaModulation::computeTimeOnAir(size_t payloadLength) const
+{
+  double symbolTime = std::ldexp(1.0, spreadingFactor) / bandwidth; // in seconds
+  // Low data rate optimization is mandated when the symbol time exceeds 16 ms
+  int lowDataRateOptimize = symbolTime > 0.016 ? 1 : 0;
+
+  double preambleTime = (preambleLength + 4.25) * symbolTime;
+  double payloadBits = 8.0 * payloadLength - 4 * spreadingFactor + 28 +
+                       (hasCrc ? 16 : 0) - (hasExplicitHeader ? 0 : 20);
+  double nPayloadSymbols = 8 + std::max(std::ceil(payloadBits / (4 * (spreadingFactor - 2 * lowDataRateOptimize))) *
+                                        (codingRate + 4), 0.0);
+
+  return time::duration_cast<time::nanoseconds>(
+    time::duration<double>(preambleTime + nPayloadSymbols * symbolTime));
+}
+
+uint64_t
+computeOverhearingKey(const Block& packet)
+{
+  try {
+    Block netPkt = packet;
+    if (packet.type() == lp::tlv::LpPacket) {
+      lp::Packet lpPacket(packet);
+      // Fragments and Nacks are never cancelled
+      if (!lpPacket.has<lp::FragmentField>() || lpPacket.has<lp::NackField>() ||
+          (lpPacket.has<lp::FragCountField>() && lpPacket.get<lp::FragCountField>() > 1)) {
+        return 0;
+      }
+      ndn::Buffer::const_iterator fragBegin, fragEnd;
+      std::tie(fragBegin, fragEnd) = lpPacket.get<lp::FragmentField>();
+      netPkt = Block(&*fragBegin, std::distance(fragBegin, fragEnd));
+    }
+
+    if (netPkt.type() != tlv::Data) {
+      return 0;
+    }
+    // Data packets are immutable, so the whole encoding identifies the full name
+    return CityHash64(reinterpret_cast<const char*>(netPkt.wire()), netPkt.size());
+  }
+  catch (const tlv::Error&) {
+    return 0;
+  }
+}
+
+LoRaSendQueue::iterator
+findReadyFrame(LoRaSendQueue& queue, time::steady_clock::TimePoint now)
+{
+  return std::find_if(queue.begin(), queue.end(),
+                      [now] (const LoRaFrame& frame) { return frame.notBefore <= now; });
+}
+
+size_t
+cancelOverheardFrames(LoRaSendQueue& queue, const Block& overheard)
+{
+  uint64_t key = computeOverhearingKey(overheard);
+  if (key == 0) {
+    return 0;
+  }
+
+  auto newEnd = std::remove_if(queue.begin(), queue.end(),
+                               [key] (const LoRaFrame& queued) { return queued.overhearingKey == key; });
+  size_t nCancelled = std::distance(newEnd, queue.end());
+  queue.erase(newEnd, queue.end());
+  return nCancelled;
+}
+
 LoRaTransport::LoRaTransport(std::pair<uint8_t, uint8_t> ids,
-                            std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*>* packetQueue, 
-                            pthread_mutex_t* queueMutex) {
+                            const FaceUri& localUri,
+                            const FaceUri& remoteUri,
+                            LoRaSendQueue* packetQueue,
+                            pthread_mutex_t* queueMutex,
+                            const LoRaModulation& modulation)
+  : m_modulation(modulation) {
 
-    // Set all of the static variables associated with this transmission (just need to set MTU)
+    // Set all of the static variables associated with this transmission
+    this->setLocalUri(localUri);
+    this->setRemoteUri(remoteUri);
+    this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+    // A broadcast face reaches every neighbor in range, and a relay must be able to forward
+    // Interests and Data back to the face they arrived on; a unicast face reaches one neighbor
+    this->setLinkType(ids.second == BROADCAST_0 ? ndn::nfd::LINK_TYPE_AD_HOC :
+                                                  ndn::nfd::LINK_TYPE_POINT_TO_POINT);
     this->setMtu(160);
 
+    // Leave enough time for a neighbor that drew a shorter deferral to transmit a full frame
+    m_maxBroadcastDeferral = 2 * getTimeOnAir(getMtu());
+
     // Read in a certain topology if flag is high (can add certain other LoRa IDs to send to and recv from)
     // if (readTopology) {
     //     std::ifstream infile(topologyFilename); 
@@ -56,20 +145,70 @@ LoRaTransport::LoRaTransport(std::pair<uint8_t, uint8_t> ids,
 }
 
 void LoRaTransport::doClose() {
-  NFD_LOG_INFO("Closiung LoRaTransport!");
-  // this->setState(TransportState::FAILED);
+  NFD_LOG_FACE_INFO("Closing LoRaTransport");
+
+  // Frames that have not been transmitted yet would keep the radio busy for a face that is gone
+  pthread_mutex_lock(threadLock);
+  auto newEnd = std::remove_if(sendBufferQueue->begin(), sendBufferQueue->end(),
+                               [this] (const LoRaFrame& frame) { return frame.sender == this; });
+  size_t nReleased = std::distance(newEnd, sendBufferQueue->end());
+  sendBufferQueue->erase(newEnd, sendBufferQueue->end());
+  pthread_mutex_unlock(threadLock);
+  NFD_LOG_FACE_DEBUG("Released " << nReleased << " queued frame(s)");
+
+  this->setState(TransportState::CLOSED);
 }
 
 void LoRaTransport::doSend(const ndn::Block &packet, const EndpointId& endpoint) {
   try
   {
+      // Copy the packets so the radio thread owns the payloads
+      std::vector<LoRaFrame> frames;
+      LoRaFrame bundle{idAndSendAddr.first, idAndSendAddr.second, {}};
+      bundle.sender = this;
+      bundle.notBefore = time::steady_clock::now();
+
+      if (idAndSendAddr.second == BROADCAST_0) {
+        // Neighbors on a broadcast face often return the same Data: defer each Data packet by a
+        // random time, so that it can be cancelled if one of them is overheard sending it first.
+        // A frame may carry several packets; every cancellable packet is queued in a frame of its
+        // own, so that cancelling it never drops the other packets, which stay together and are
+        // not deferred.
+        size_t offset = 0;
+        while (offset < packet.size()) {
+          Block element(packet.wire() + offset, packet.size() - offset);
+          offset += element.size();
+
+          uint64_t key = computeOverhearingKey(element);
+          if (key == 0) {
+            bundle.payload.insert(bundle.payload.end(), element.begin(), element.end());
+            continue;
+          }
+
+          LoRaFrame frame{bundle.src, bundle.dst, ndn::Buffer(element.wire(), element.size())};
+          frame.sender = this;
+          frame.overhearingKey = key;
+          std::uniform_int_distribution<time::nanoseconds::rep> dist(0, m_maxBroadcastDeferral.count());
+          frame.notBefore = bundle.notBefore + time::nanoseconds(dist(ndn::random::getRandomNumberEngine()));
+          frames.push_back(std::move(frame));
+        }
+      }
+      else {
+        bundle.payload.assign(packet.begin(), packet.end());
+      }
+
+      if (!bundle.payload.empty()) {
+        frames.insert(frames.begin(), std::move(bundle));
+      }
+
+      for (const auto& frame : frames) {
+        getLinkQuality().addTransmission(frame.payload.size(), getTimeOnAir(frame.payload.size()));
+      }
+
       pthread_mutex_lock(threadLock);
-      ndn::encoding::EncodingBuffer *toSendBuff = new ndn::EncodingBuffer(packet);
-      std::pair<uint8_t, uint8_t> *ids = new std::pair<uint8_t, uint8_t>(idAndSendAddr.first, idAndSendAddr.second);
-      std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>* pairToPush = new std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>(ids, toSendBuff);
-      sendBufferQueue->push(pairToPush);
+      std::move(frames.begin(), frames.end(), std::back_inserter(*sendBufferQueue));
       pthread_mutex_unlock(threadLock);
-      NFD_LOG_FACE_INFO("Sending data");
+      NFD_LOG_FACE_INFO("Sending data in " << frames.size() << " frame(s)");
   }
   catch(const std::exception& e)
   {
@@ -84,6 +223,55 @@ LoRaTransport::receiveData(ndn::Block data) {
   this->receive(data);
 }
 
+void
+LoRaTransport::recordReception(int rssi, int snr, size_t nMissedFrames) {
+  getLinkQuality().addSignalSample(rssi, snr);
+  getLinkQuality().addReceptions(1, nMissedFrames);
+}
+
+time::nanoseconds
+LoRaTransport::getSendQueueDelay() {
+  time::nanoseconds delay = 0_ns;
+  pthread_mutex_lock(threadLock);
+  for (const auto& frame : *sendBufferQueue) {
+    delay += m_modulation.computeTimeOnAir(frame.payload.size() + LORA_FRAME_HEADER_SIZE);
+  }
+  pthread_mutex_unlock(threadLock);
+  return delay;
+}
+
+ssize_t
+LoRaTransport::getSendQueueLength() {
+  ssize_t length = 0;
+  pthread_mutex_lock(threadLock);
+  for (const auto& frame : *sendBufferQueue) {
+    if (frame.sender == this) {
+      length += frame.payload.size();
+    }
+  }
+  pthread_mutex_unlock(threadLock);
+  return length;
+}
+
+time::nanoseconds
+LoRaTransport::getSendQueueSojournTime() {
+  auto now = time::steady_clock::now();
+  auto oldest = now;
+  pthread_mutex_lock(threadLock);
+  for (const auto& frame : *sendBufferQueue) {
+    if (frame.sender == this) {
+      oldest = std::min(oldest, frame.notBefore);
+    }
+  }
+  pthread_mutex_unlock(threadLock);
+  return now - oldest;
+}
+
+time::nanoseconds
+LoRaTransport::getTimeOnAir(size_t packetSize) const {
+  return m_modulation.computeTimeOnAir(packetSize + LORA_FRAME_HEADER_SIZE);
+}
+
 void LoRaTransport::handleError(const std::string &errorMessage) {
   if (getPersistency() == ndn::nfd::FACE_PERSISTENCY_PERMANENT) {
     NFD_LOG_ERROR("Permanent face ignores error: " << errorMessage);
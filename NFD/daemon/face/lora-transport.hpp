@@ -12,15 +12,98 @@
 #include <string>
 #include <pthread.h>
 #include <queue>
-#include "pcap-helper.hpp"
 #include <fstream>
 #include <unordered_set>
+#include <deque>
 
 namespace nfd
 {
 namespace face
 {
 
+/**
+ * @brief LoRa modulation settings of the radio, which determine the time-on-air of a frame
+ */
+struct LoRaModulation
+{
+    uint8_t spreadingFactor = 7;
+    uint32_t bandwidth = 500000; ///< in Hz
+    uint8_t codingRate = 1; ///< 1 to 4, for coding rates 4/5 to 4/8
+    uint16_t preambleLength = 8; ///< in symbols
+    bool hasExplicitHeader = true;
+    bool hasCrc = true;
+
+    /**
+     * @brief Computes the time-on-air of a LoRa frame (Semtech SX1272 datasheet, section 4.1.1.7)
+     * @param payloadLength length of the radio payload in octets, including the frame header
+     *                      added by the radio library
+     */
+    time::nanoseconds
+    computeTimeOnAir(size_t payloadLength) const;
+};
+
+class LoRaTransport;
+
+/**
+ * @brief A frame waiting in the send queue shared by all LoRa transports on the radio
+ */
+struct LoRaFrame
+{
+    uint8_t src;
+    uint8_t dst;
+    ndn::Buffer payload;
+    /// transport that enqueued the frame, only used to identify its frames
+    const LoRaTransport* sender = nullptr;
+    /// time the frame was enqueued, plus a random deferral for frames that can be cancelled if
+    /// overheard; the frame is not transmitted before this time
+    time::steady_clock::TimePoint notBefore = time::steady_clock::TimePoint::min();
+    /// key identifying the network packet for overhearing-based cancellation, zero if none
+    uint64_t overhearingKey = 0;
+};
+
+using LoRaSendQueue = std::deque<LoRaFrame>;
+
+/**
+ * @brief Octets added to every frame by the radio library (dst, src, packnum, length, retry)
+ */
+const size_t LORA_FRAME_HEADER_SIZE = 5;
+
+/**
+ * @brief Computes the key identifying a network packet for overhearing-based cancellation
+ * @param packet one packet found in a LoRa frame; a frame may carry several bundled packets,
+ *               each of which has its own key
+ *
+ * Two packets carrying the same Data (full name) have the same key, even if they were sent by
+ * different nodes with different NDNLPv2 headers.
+ *
+ * Interests have no key, and are thus neither deferred nor cancelled by the transport: the
+ * forwarding strategy (e.g., AdHocStrategy) defers and cancels them, and ranks the deferral of
+ * each node by whether it is on the Data path, which the transport does not know.
+ *
+ * @return the key, or zero if @p packet is not a complete Data packet
+ */
+uint64_t
+computeOverhearingKey(const Block& packet);
+
+/**
+ * @brief Returns the first frame in @p queue that may be transmitted at @p now
+ *
+ * Frames are transmitted in the order they were enqueued, except that a frame whose deferral
+ * has not elapsed does not hold back the ready frames behind it. A deferred broadcast frame may
+ * thus be transmitted after frames enqueued later, which is intended: it is deferred to give
+ * neighbors the chance to transmit the same packet first, and nothing depends on its position.
+ */
+LoRaSendQueue::iterator
+findReadyFrame(LoRaSendQueue& queue, time::steady_clock::TimePoint now);
+
+/**
+ * @brief Removes the frames in @p queue that carry the same network packet as @p overheard
+ * @param overheard one packet found in a frame transmitted by a neighbor
+ * @return number of removed frames; frames whose overhearing key is zero are never removed
+ */
+size_t
+cancelOverheardFrames(LoRaSendQueue& queue, const Block& overheard);
+
 class LoRaTransport : public Transport
 {
     class Error : public std::runtime_error
@@ -37,6 +120,9 @@ class LoRaTransport : public Transport
 
 protected:
 
+    /**
+     * @brief Removes the frames of this transport from the shared send queue
+     */
     void
     doClose() final;
 
@@ -58,18 +144,61 @@ private:
     std::unordered_set<uint8_t> send = std::unordered_set<uint8_t>();
     std::unordered_set<uint8_t> recv = std::unordered_set<uint8_t>();
 
-    // Block to store stuff in
-    std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*>* sendBufferQueue;
+    // Frames waiting to be sent by the radio, shared with other LoRa transports
+    LoRaSendQueue* sendBufferQueue;
     pthread_mutex_t* threadLock;
 
+    LoRaModulation m_modulation;
+
+    // Frames sent on a broadcast face are deferred by a random time up to this value
+    time::nanoseconds m_maxBroadcastDeferral;
+
 public:
     LoRaTransport(  std::pair<uint8_t, uint8_t> ids,
-                    std::queue<std::pair<std::pair<uint8_t, uint8_t>*, ndn::encoding::EncodingBuffer *>*>* packetQueue, 
-                    pthread_mutex_t* queueMutex);
+                    const FaceUri& localUri,
+                    const FaceUri& remoteUri,
+                    LoRaSendQueue* packetQueue,
+                    pthread_mutex_t* queueMutex,
+                    const LoRaModulation& modulation);
 
     void
     receiveData(ndn::Block data);
 
+    /**
+     * @brief Updates the link quality with a frame received from the neighbor
+     * @param rssi RSSI of the frame, in dBm
+     * @param snr SNR of the frame, in dB
+     * @param nMissedFrames number of frames the neighbor sent before this one that were not received
+     */
+    void
+    recordReception(int rssi, int snr, size_t nMissedFrames);
+
+    /**
+     * @return time until all frames currently in the shared send queue have been transmitted
+     */
+    time::nanoseconds
+    getSendQueueDelay() final;
+
+    /**
+     * @return octets in the frames of this transport waiting in the shared send queue
+     */
+    ssize_t
+    getSendQueueLength() final;
+
+    /**
+     * @return time the oldest frame of this transport in the shared send queue has been waiting
+     *         since its deferral (if any) elapsed
+     *
+     * Only the frames of this transport are considered, so that congestion is marked on the faces
+     * that fill the radio queue. Frames of the other faces on the radio still delay these frames,
+     * and thus contribute to their sojourn time.
+     */
+    time::nanoseconds
+    getSendQueueSojournTime() final;
+
+    time::nanoseconds
+    getTimeOnAir(size_t packetSize) const final;
+
 };
 
 } // namespace face
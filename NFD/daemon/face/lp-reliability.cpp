@@ -66,6 +66,9 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
 
   auto unackedFragsIt = m_unackedFrags.begin();
   auto sendTime = time::steady_clock::now();
+  Transport* transport = m_linkService->getTransport();
+  // each fragment is queued behind the preceding fragments of the same network packet
+  auto queueDelay = transport->getSendQueueDelay();
 
   auto netPkt = make_shared<NetPkt>(std::move(pkt), isInterest);
   netPkt->unackedFrags.reserve(frags.size());
@@ -73,6 +76,7 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
   for (lp::Packet& frag : frags) {
     // Assign TxSequence number
     lp::Sequence txSeq = assignTxSequence(frag);
+    size_t fragSize = frag.wireEncode().size();
 
     // Store LpPacket for future retransmissions
     unackedFragsIt = m_unackedFrags.emplace_hint(unackedFragsIt,
@@ -80,9 +84,10 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
                                                  std::forward_as_tuple(txSeq),
                                                  std::forward_as_tuple(frag));
     unackedFragsIt->second.sendTime = sendTime;
-    unackedFragsIt->second.rtoTimer = getScheduler().schedule(m_rttEst.getEstimatedRto(),
+    unackedFragsIt->second.rtoTimer = getScheduler().schedule(computeRto(fragSize, queueDelay),
                                                               [=] { onLpPacketLost(txSeq); });
     unackedFragsIt->second.netPkt = netPkt;
+    queueDelay += transport->getTimeOnAir(fragSize);
 
     if (m_unackedFrags.size() == 1) {
       m_firstUnackedFrag = m_unackedFrags.begin();
@@ -104,8 +109,21 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
   for (lp::Sequence ackSeq : pkt.list<lp::AckField>()) {
     auto fragIt = m_unackedFrags.find(ackSeq);
     if (fragIt == m_unackedFrags.end()) {
-      // Ignore an Ack for an unknown TxSequence number
-      continue;
+      auto supersededIt = m_supersededTxs.find(ackSeq);
+      if (supersededIt == m_supersededTxs.end()) {
+        // Ignore an Ack for an unknown TxSequence number
+        continue;
+      }
+
+      // An earlier transmission of a retransmitted fragment has been received, so the
+      // retransmission was spurious. Since every transmission carries its own TxSequence, the
+      // RTT sample of the earlier transmission is unambiguous.
+      ++m_linkService->nSpuriousRetx;
+      m_rttEst.addMeasurement(now - supersededIt->second.sendTime);
+
+      // Consider the latest transmission of this fragment as acknowledged
+      fragIt = m_unackedFrags.find(supersededIt->second.currentTxSeq);
+      BOOST_ASSERT(fragIt != m_unackedFrags.end());
     }
     auto& frag = fragIt->second;
 
@@ -242,8 +260,10 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
   auto netPkt = txFrag.netPkt;
   std::vector<lp::Sequence> removedThisTxSeq;
 
-  // Check if maximum number of retransmissions exceeded
-  if (txFrag.retxCount >= m_options.maxRetx) {
+  m_linkService->getTransport()->getLinkQuality().addTransmissionOutcome(false);
+
+  // Check if maximum number of retransmissions or retransmission airtime budget exceeded
+  if (isRetxLimitReached(txFrag)) {
     // Delete all LpPackets of NetPkt from m_unackedFrags (except this one)
     for (size_t i = 0; i < netPkt->unackedFrags.size(); i++) {
       if (netPkt->unackedFrags[i] != txSeqIt) {
@@ -283,6 +303,14 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
     newTxFrag.retxCount = txFrag.retxCount + 1;
     newTxFrag.netPkt = netPkt;
 
+    // Remember earlier transmissions, so that an Ack for any of them can be recognized
+    newTxFrag.supersededTxSeqs.swap(txFrag.supersededTxSeqs);
+    newTxFrag.supersededTxSeqs.push_back(txSeq);
+    for (lp::Sequence supersededTxSeq : newTxFrag.supersededTxSeqs) {
+      m_supersededTxs[supersededTxSeq].currentTxSeq = newTxSeq;
+    }
+    m_supersededTxs[txSeq].sendTime = txFrag.sendTime;
+
     // Update associated NetPkt
     auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeqIt);
     BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
@@ -292,10 +320,14 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
     deleteUnackedFrag(txSeqIt);
 
     // Retransmit fragment
+    Transport* transport = m_linkService->getTransport();
+    auto queueDelay = transport->getSendQueueDelay();
+    size_t fragSize = newTxFrag.pkt.wireEncode().size();
+    netPkt->retxAirtime += transport->getTimeOnAir(fragSize);
     m_linkService->sendLpPacket(lp::Packet(newTxFrag.pkt), 0);
 
     // Start RTO timer for this sequence
-    newTxFrag.rtoTimer = getScheduler().schedule(m_rttEst.getEstimatedRto(),
+    newTxFrag.rtoTimer = getScheduler().schedule(computeRto(fragSize, queueDelay),
                                                  [=] { onLpPacketLost(newTxSeq); });
   }
 
@@ -307,6 +339,8 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
 {
   auto netPkt = fragIt->second.netPkt;
 
+  m_linkService->getTransport()->getLinkQuality().addTransmissionOutcome(true);
+
   // Remove from NetPkt unacked fragment list
   auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), fragIt);
   BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
@@ -329,6 +363,10 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
 void
 LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
 {
+  for (lp::Sequence supersededTxSeq : fragIt->second.supersededTxSeqs) {
+    m_supersededTxs.erase(supersededTxSeq);
+  }
+
   lp::Sequence firstUnackedTxSeq = m_firstUnackedFrag->first;
   lp::Sequence currentTxSeq = fragIt->first;
   auto nextFragIt = m_unackedFrags.erase(fragIt);
@@ -347,6 +385,40 @@ LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
   }
 }
 
+time::nanoseconds
+LpReliability::computeRto(size_t fragSize, time::nanoseconds queueDelay) const
+{
+  auto rto = m_rttEst.getEstimatedRto();
+
+  const Transport* transport = m_linkService->getTransport();
+  auto timeOnAir = transport->getTimeOnAir(fragSize);
+  if (timeOnAir <= 0_ns) {
+    return rto;
+  }
+
+  // An Ack cannot arrive before the fragment has left the send queue and has been transmitted,
+  // and the peer has sent back an IDLE packet upon expiration of its idle Ack timer
+  auto minRto = queueDelay + timeOnAir + m_options.idleAckTimerPeriod +
+                transport->getTimeOnAir(IDLE_ACK_PACKET_SIZE);
+  if (!m_rttEst.hasSamples()) {
+    minRto *= 2;
+  }
+  return std::max(rto, minRto);
+}
+
+bool
+LpReliability::isRetxLimitReached(const UnackedFrag& frag) const
+{
+  if (m_options.maxRetxAirtime > 0_ns) {
+    auto timeOnAir = m_linkService->getTransport()->getTimeOnAir(frag.pkt.wireEncode().size());
+    if (timeOnAir > 0_ns) {
+      return frag.netPkt->retxAirtime + timeOnAir > m_options.maxRetxAirtime;
+    }
+  }
+
+  return frag.retxCount >= m_options.maxRetx;
+}
+
 LpReliability::UnackedFrag::UnackedFrag(lp::Packet pkt)
   : pkt(std::move(pkt))
   , sendTime(time::steady_clock::now())
@@ -359,6 +431,7 @@ LpReliability::NetPkt::NetPkt(lp::Packet&& pkt, bool isInterest)
   : pkt(std::move(pkt))
   , isInterest(isInterest)
   , didRetx(false)
+  , retxAirtime(0_ns)
 {
 }
 
@@ -52,9 +52,19 @@ public:
     bool isEnabled = false;
 
     /** \brief maximum number of retransmissions for an LpPacket
+     *
+     *  This limit is not applied if \p maxRetxAirtime is in effect.
      */
     size_t maxRetx = 3;
 
+    /** \brief maximum time-on-air that may be spent retransmitting the fragments of one network
+     *         packet
+     *
+     *  This budget is in effect only if it is positive and the Transport models time-on-air
+     *  (see Transport::getTimeOnAir); otherwise, retransmissions are limited by \p maxRetx.
+     */
+    time::nanoseconds maxRetxAirtime = 0_ns;
+
     /** \brief period between sending pending Acks in an IDLE packet
      */
     time::nanoseconds idleAckTimerPeriod = 5_ms;
@@ -161,6 +171,22 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   deleteUnackedFrag(UnackedFrags::iterator fragIt);
 
+  /** \brief compute the retransmission timeout of a fragment
+   *  \param fragSize size of the fragment in octets
+   *  \param queueDelay expected time the fragment waits in the Transport send queue
+   *
+   *  If the Transport models time-on-air, the RTO is never less than the time needed to transmit
+   *  the fragment and to receive an Ack for it. Before any RTT sample is available, the RTO is
+   *  seeded with twice this value to account for queueing at the peer.
+   */
+  time::nanoseconds
+  computeRto(size_t fragSize, time::nanoseconds queueDelay) const;
+
+  /** \brief determine whether a lost fragment may not be retransmitted again
+   */
+  bool
+  isRetxLimitReached(const UnackedFrag& frag) const;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief contains a sent fragment that has not been acknowledged and associated data
    */
@@ -177,6 +203,18 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     size_t retxCount;
     size_t nGreaterSeqAcks; //!< number of Acks received for sequences greater than this fragment
     shared_ptr<NetPkt> netPkt;
+    std::vector<lp::Sequence> supersededTxSeqs; //!< TxSequences of earlier transmissions
+  };
+
+  /** \brief an earlier transmission of a fragment that has since been retransmitted
+   *
+   *  An Ack for a superseded TxSequence indicates that the retransmission was spurious.
+   */
+  class SupersededTx
+  {
+  public:
+    lp::Sequence currentTxSeq; //!< TxSequence of the latest transmission of the fragment
+    time::steady_clock::TimePoint sendTime;
   };
 
   /** \brief contains a network-layer packet with unacknowledged fragments
@@ -191,6 +229,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     lp::Packet pkt;
     bool isInterest;
     bool didRetx;
+    time::nanoseconds retxAirtime; //!< total time-on-air spent on retransmissions
   };
 
 public:
@@ -199,6 +238,11 @@ public:
                                                   tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
                                                   sizeof(lp::Sequence);
 
+  /// IDLE packet carrying a single Ack: LpPacket TLV-TYPE and TLV-LENGTH + Ack field
+  static constexpr size_t IDLE_ACK_PACKET_SIZE = 2 + tlv::sizeOfVarNumber(lp::tlv::Ack) +
+                                                 tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
+                                                 sizeof(lp::Sequence);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Options m_options;
   GenericLinkService* m_linkService;
@@ -209,6 +253,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    *  first fragment in the map will become the start of the window.
    */
   UnackedFrags::iterator m_firstUnackedFrag;
+  std::map<lp::Sequence, SupersededTx> m_supersededTxs;
   std::queue<lp::Sequence> m_ackQueue;
   lp::Sequence m_lastTxSeqNo;
   scheduler::ScopedEventId m_idleAckTimer;
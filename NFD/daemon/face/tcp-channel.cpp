@@ -36,12 +36,13 @@ NFD_LOG_INIT(TcpChannel);
 
 namespace ip = boost::asio::ip;
 
-TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
+TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking, bool wantPitToken,
                        DetermineFaceScopeFromAddress determineFaceScope)
   : m_localEndpoint(localEndpoint)
   , m_acceptor(getGlobalIoService())
   , m_socket(getGlobalIoService())
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_wantPitToken(wantPitToken)
   , m_determineFaceScope(std::move(determineFaceScope))
 {
   setUri(FaceUri(m_localEndpoint));
@@ -108,6 +109,7 @@ TcpChannel::createFace(ip::tcp::socket&& socket,
     GenericLinkService::Options options;
     options.allowLocalFields = params.wantLocalFields;
     options.reliabilityOptions.isEnabled = params.wantLpReliability;
+    options.allowPitToken = m_wantPitToken;
 
     if (boost::logic::indeterminate(params.wantCongestionMarking)) {
       // Use default value for this channel if parameter is indeterminate
@@ -55,7 +55,7 @@ public:
    * To enable creation faces upon incoming connections,
    * one needs to explicitly call TcpChannel::listen method.
    */
-  TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
+  TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking, bool wantPitToken,
              DetermineFaceScopeFromAddress determineFaceScope);
 
   bool
@@ -129,6 +129,7 @@ private:
   boost::asio::ip::tcp::socket m_socket;
   std::map<tcp::Endpoint, shared_ptr<Face>> m_channelFaces;
   bool m_wantCongestionMarking;
+  bool m_wantPitToken;
   DetermineFaceScopeFromAddress m_determineFaceScope;
 };
 
@@ -50,6 +50,7 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   port 6363
   //   enable_v4 yes
   //   enable_v6 yes
+  //   pit_token no
   // }
 
   m_wantCongestionMarking = context.generalConfig.wantCongestionMarking;
@@ -65,6 +66,7 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
   uint16_t port = 6363;
   bool enableV4 = true;
   bool enableV6 = true;
+  bool wantPitToken = false;
   IpAddressPredicate local;
   bool isLocalConfigured = false;
 
@@ -83,6 +85,9 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
     else if (key == "enable_v6") {
       enableV6 = ConfigFile::parseYesNo(pair, "face_system.tcp");
     }
+    else if (key == "pit_token") {
+      wantPitToken = ConfigFile::parseYesNo(pair, "face_system.tcp");
+    }
     else if (key == "local") {
       isLocalConfigured = true;
       for (const auto& localPair : pair.second) {
@@ -118,6 +123,11 @@ TcpFactory::doProcessConfig(OptionalConfigSection configSection,
 
   providedSchemes.insert("tcp");
 
+  if (m_wantPitToken != wantPitToken && !m_channels.empty()) {
+    NFD_LOG_WARN("PIT token setting applies to new TCP channels only");
+  }
+  m_wantPitToken = wantPitToken;
+
   if (enableV4) {
     tcp::Endpoint endpoint(ip::tcp::v4(), port);
     auto v4Channel = this->createChannel(endpoint);
@@ -200,7 +210,7 @@ TcpFactory::createChannel(const tcp::Endpoint& endpoint)
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = make_shared<TcpChannel>(endpoint, m_wantCongestionMarking,
+  auto channel = make_shared<TcpChannel>(endpoint, m_wantCongestionMarking, m_wantPitToken,
                                          bind(&TcpFactory::determineFaceScopeFromAddresses, this, _1, _2));
   m_channels[endpoint] = channel;
   return channel;
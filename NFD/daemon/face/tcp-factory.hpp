@@ -77,6 +77,7 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  bool m_wantPitToken = false;
   std::map<tcp::Endpoint, shared_ptr<TcpChannel>> m_channels;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_TRANSPORT_HPP
 
 #include "face-common.hpp"
+#include "link-quality-estimator.hpp"
 #include "common/counter.hpp"
 
 namespace nfd {
@@ -98,6 +99,10 @@ const ssize_t MTU_INVALID = -2;
  */
 const ssize_t QUEUE_UNSUPPORTED = -1;
 
+/** \brief indicates that the transport does not support measuring the sojourn time of its send queue
+ */
+const time::nanoseconds SOJOURN_TIME_UNSUPPORTED = time::nanoseconds::min();
+
 /** \brief indicates that the transport was unable to retrieve the queue capacity/length
  */
 const ssize_t QUEUE_ERROR = -2;
@@ -259,6 +264,51 @@ public: // dynamic properties
     return QUEUE_UNSUPPORTED;
   }
 
+  /** \return expected time a packet newly passed to send() waits in the send queue
+   *          before its transmission begins
+   *  \retval time::nanoseconds::zero() transport does not support queueing delay estimation
+   */
+  virtual time::nanoseconds
+  getSendQueueDelay()
+  {
+    return 0_ns;
+  }
+
+  /** \return how long the oldest packet in the send queue has been waiting for transmission
+   *  \retval time::nanoseconds::zero() send queue is empty
+   *  \retval SOJOURN_TIME_UNSUPPORTED transport does not support sojourn time measurement
+   *
+   *  If supported, congestion is detected by the sojourn time of the send queue instead of its length.
+   */
+  virtual time::nanoseconds
+  getSendQueueSojournTime()
+  {
+    return SOJOURN_TIME_UNSUPPORTED;
+  }
+
+  /** \return time needed to transmit a packet of \p packetSize octets on the medium
+   *
+   *  This is meaningful for transports over low-rate shared media (e.g., LoRa), where the
+   *  time-on-air of a packet dominates the link delay and limits the link capacity.
+   *
+   *  \retval time::nanoseconds::zero() transport does not model time-on-air
+   */
+  virtual time::nanoseconds
+  getTimeOnAir(size_t packetSize) const
+  {
+    return 0_ns;
+  }
+
+  /** \return estimated quality of the link to the remote endpoint
+   */
+  const LinkQualityEstimator&
+  getLinkQuality() const;
+
+  /** \return estimator of the link quality, to be fed by the transport and its LinkService
+   */
+  LinkQualityEstimator&
+  getLinkQuality();
+
 protected: // upper interface to be invoked by subclass
   /** \brief Pass a received link-layer packet to the upper layer for further processing
    *  \param packet the received packet, must be a valid and well-formed TLV block
@@ -358,6 +408,7 @@ private:
   ssize_t m_sendQueueCapacity;
   TransportState m_state;
   time::steady_clock::TimePoint m_expirationTime;
+  LinkQualityEstimator m_linkQuality;
 };
 
 inline const Face*
@@ -378,6 +429,18 @@ Transport::getLinkService()
   return m_service;
 }
 
+inline const LinkQualityEstimator&
+Transport::getLinkQuality() const
+{
+  return m_linkQuality;
+}
+
+inline LinkQualityEstimator&
+Transport::getLinkQuality()
+{
+  return m_linkQuality;
+}
+
 inline const Transport::Counters&
 Transport::getCounters() const
 {
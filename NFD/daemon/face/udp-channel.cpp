@@ -38,11 +38,15 @@ namespace ip = boost::asio::ip;
 
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        time::nanoseconds idleTimeout,
-                       bool wantCongestionMarking)
+                       bool wantCongestionMarking,
+                       bool wantBundling,
+                       bool wantPitToken)
   : m_localEndpoint(localEndpoint)
   , m_socket(getGlobalIoService())
   , m_idleFaceTimeout(idleTimeout)
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_wantBundling(wantBundling)
+  , m_wantPitToken(wantPitToken)
 {
   setUri(FaceUri(m_localEndpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
@@ -164,6 +168,8 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
   options.allowFragmentation = true;
   options.allowReassembly = true;
   options.reliabilityOptions.isEnabled = params.wantLpReliability;
+  options.allowBundling = m_wantBundling;
+  options.allowPitToken = m_wantPitToken;
 
   if (boost::logic::indeterminate(params.wantCongestionMarking)) {
     // Use default value for this channel if parameter is indeterminate
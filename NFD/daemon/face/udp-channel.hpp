@@ -49,7 +49,9 @@ public:
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              time::nanoseconds idleTimeout,
-             bool wantCongestionMarking);
+             bool wantCongestionMarking,
+             bool wantBundling,
+             bool wantPitToken);
 
   bool
   isListening() const override
@@ -114,6 +116,8 @@ private:
   std::map<udp::Endpoint, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
   bool m_wantCongestionMarking;
+  bool m_wantBundling;
+  bool m_wantPitToken;
 };
 
 } // namespace face
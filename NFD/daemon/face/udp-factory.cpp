@@ -66,6 +66,8 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   enable_v4 yes
   //   enable_v6 yes
   //   idle_timeout 600
+  //   bundling no
+  //   pit_token no
   //   mcast yes
   //   mcast_group 224.0.23.170
   //   mcast_port 56363
@@ -88,6 +90,8 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   bool enableV4 = false;
   bool enableV6 = false;
   uint32_t idleTimeout = 600;
+  bool wantBundling = false;
+  bool wantPitToken = false;
   MulticastConfig mcastConfig;
 
   if (configSection) {
@@ -113,6 +117,12 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         idleTimeout = ConfigFile::parseNumber<uint32_t>(pair, "face_system.udp");
       }
+      else if (key == "bundling") {
+        wantBundling = ConfigFile::parseYesNo(pair, "face_system.udp");
+      }
+      else if (key == "pit_token") {
+        wantPitToken = ConfigFile::parseYesNo(pair, "face_system.udp");
+      }
       else if (key == "keep_alive_interval") {
         // ignored
       }
@@ -177,6 +187,15 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
     return;
   }
 
+  if (m_wantBundling != wantBundling && !m_channels.empty()) {
+    NFD_LOG_WARN("Bundling setting applies to new UDP channels only");
+  }
+  if (m_wantPitToken != wantPitToken && !m_channels.empty()) {
+    NFD_LOG_WARN("PIT token setting applies to new UDP channels only");
+  }
+  m_wantBundling = wantBundling;
+  m_wantPitToken = wantPitToken;
+
   if (enableV4) {
     udp::Endpoint endpoint(ip::udp::v4(), port);
     shared_ptr<UdpChannel> v4Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
@@ -302,7 +321,8 @@ UdpFactory::createChannel(const udp::Endpoint& localEndpoint,
                     ", endpoint already allocated to a UDP multicast face"));
   }
 
-  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout, m_wantCongestionMarking);
+  auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout,
+                                              m_wantCongestionMarking, m_wantBundling, m_wantPitToken);
   m_channels[localEndpoint] = channel;
   return channel;
 }
@@ -354,6 +374,8 @@ UdpFactory::createMulticastFace(const shared_ptr<const net::NetworkInterface>& n
 
   GenericLinkService::Options options;
   options.allowCongestionMarking = m_wantCongestionMarking;
+  options.allowBundling = m_wantBundling;
+  options.allowPitToken = m_wantPitToken;
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<MulticastUdpTransport>(mcastEp, std::move(rxSock), std::move(txSock),
                                                       m_mcastConfig.linkType);
@@ -123,6 +123,8 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  bool m_wantBundling = false;
+  bool m_wantPitToken = false;
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
 
   struct MulticastConfig
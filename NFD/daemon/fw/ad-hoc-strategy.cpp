@@ -0,0 +1,224 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ad-hoc-strategy.hpp"
+#include "algorithm.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(AdHocStrategy);
+NFD_LOG_INIT(AdHocStrategy);
+
+const time::milliseconds AdHocStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds AdHocStrategy::RETX_SUPPRESSION_MAX(250);
+const time::milliseconds AdHocStrategy::MIN_DEFERRAL_WINDOW(10);
+const time::seconds AdHocStrategy::DATA_PATH_LIFETIME(60);
+
+AdHocStrategy::AdHocStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    NDN_THROW(std::invalid_argument("AdHocStrategy does not accept parameters"));
+  }
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    NDN_THROW(std::invalid_argument(
+      "AdHocStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+AdHocStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/ad-hoc/%FD%01");
+  return strategyName;
+}
+
+void
+AdHocStrategy::afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+  PitInfo* pitInfo = pitEntry->getStrategyInfo<PitInfo>();
+
+  int nEligibleNextHops = 0;
+
+  bool isSuppressed = false;
+
+  for (const auto& nexthop : nexthops) {
+    Face& outFace = nexthop.getFace();
+
+    if (pitInfo != nullptr && pitInfo->deferredSends.count(outFace.getId()) > 0) {
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " to=" << outFace.getId() << " already-deferred");
+      ++nEligibleNextHops;
+      continue;
+    }
+
+    RetxSuppressionResult suppressResult = m_retxSuppression.decidePerUpstream(*pitEntry, outFace);
+
+    if (suppressResult == RetxSuppressionResult::SUPPRESS) {
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " to=" << outFace.getId() << " suppressed");
+      isSuppressed = true;
+      continue;
+    }
+
+    if (!isNextHopEligible(ingress.face, interest, nexthop, pitEntry)) {
+      continue;
+    }
+    ++nEligibleNextHops;
+
+    if (suppressResult == RetxSuppressionResult::NEW &&
+        outFace.getLinkType() == ndn::nfd::LINK_TYPE_AD_HOC) {
+      this->deferInterest(pitEntry, outFace, interest, this->isOnDataPath(*pitEntry, outFace));
+      continue;
+    }
+
+    this->sendInterest(pitEntry, FaceEndpoint(outFace, 0), interest);
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " pitEntry-to=" << outFace.getId());
+
+    if (suppressResult == RetxSuppressionResult::FORWARD) {
+      m_retxSuppression.incrementIntervalForOutRecord(*pitEntry->getOutRecord(outFace));
+    }
+  }
+
+  if (nEligibleNextHops == 0 && !isSuppressed) {
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, ingress, nackHeader);
+
+    this->rejectPendingInterest(pitEntry);
+  }
+}
+
+void
+AdHocStrategy::afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                          const shared_ptr<pit::Entry>& pitEntry)
+{
+  PitInfo* pitInfo = pitEntry->getStrategyInfo<PitInfo>();
+  if (pitInfo == nullptr) {
+    return;
+  }
+
+  // another node has forwarded this Interest on the shared medium, so we do not need to
+  auto it = pitInfo->deferredSends.find(ingress.face.getId());
+  if (it != pitInfo->deferredSends.end()) {
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " overheard, cancel-deferred");
+    pitInfo->deferredSends.erase(it);
+  }
+}
+
+void
+AdHocStrategy::afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
+                                const FaceEndpoint& ingress, const Data& data)
+{
+  if (ingress.face.getLinkType() == ndn::nfd::LINK_TYPE_AD_HOC) {
+    measurements::Entry* me = this->getMeasurements().get(this->lookupFib(*pitEntry));
+    if (me != nullptr) {
+      this->getMeasurements().extendLifetime(*me, DATA_PATH_LIFETIME);
+      // Data solicited by this node has an out-record, otherwise a neighbor fetched it
+      bool isSolicited = pitEntry->getOutRecord(ingress.face) != pitEntry->out_end();
+      me->insertStrategyInfo<DataPathInfo>().first->isOnDataPath[ingress.face.getId()] = isSolicited;
+      NFD_LOG_DEBUG("afterReceiveData pitEntry=" << pitEntry->getName() << " in=" << ingress
+                    << (isSolicited ? " on-data-path" : " overheard"));
+    }
+  }
+
+  Strategy::afterReceiveData(pitEntry, ingress, data);
+}
+
+void
+AdHocStrategy::afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
+                                const shared_ptr<pit::Entry>& pitEntry)
+{
+  this->processNack(ingress.face, nack, pitEntry);
+}
+
+time::nanoseconds
+AdHocStrategy::getDeferralWindow(const Face& face, const Interest& interest)
+{
+  time::nanoseconds timeOnAir = face.getTransport()->getTimeOnAir(interest.wireEncode().size());
+  return std::max<time::nanoseconds>(2 * timeOnAir, MIN_DEFERRAL_WINDOW);
+}
+
+void
+AdHocStrategy::deferInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outFace,
+                             const Interest& interest, bool isOnDataPath)
+{
+  time::nanoseconds window = getDeferralWindow(outFace, interest);
+  time::nanoseconds::rep halfWindow = window.count() / 2;
+  std::uniform_int_distribution<time::nanoseconds::rep> dist(0, halfWindow);
+  time::nanoseconds deferral(dist(ndn::random::getRandomNumberEngine()) + (isOnDataPath ? 0 : halfWindow));
+
+  NFD_LOG_DEBUG(interest << " to=" << outFace.getId() << " deferred=" << deferral
+                << (isOnDataPath ? " on-data-path" : ""));
+
+  auto pitInfo = pitEntry->insertStrategyInfo<PitInfo>().first;
+  pitInfo->deferredSends[outFace.getId()] = getScheduler().schedule(deferral,
+    [this, weakPitEntry = weak_ptr<pit::Entry>(pitEntry), faceId = outFace.getId()] {
+      auto pitEntry = weakPitEntry.lock();
+      Face* outFace = this->getFace(faceId);
+      if (pitEntry == nullptr || outFace == nullptr || pitEntry->isSatisfied ||
+          !pitEntry->hasInRecords()) {
+        return;
+      }
+
+      NFD_LOG_DEBUG(pitEntry->getInterest() << " pitEntry-to=" << faceId << " after-deferral");
+      this->sendInterest(pitEntry, FaceEndpoint(*outFace, 0), pitEntry->getInterest());
+      pitEntry->getStrategyInfo<PitInfo>()->deferredSends.erase(faceId);
+    });
+}
+
+bool
+AdHocStrategy::isOnDataPath(const pit::Entry& pitEntry, const Face& face)
+{
+  measurements::Entry* me = this->getMeasurements().findExactMatch(this->lookupFib(pitEntry).getPrefix());
+  if (me == nullptr) {
+    return false;
+  }
+
+  DataPathInfo* info = me->getStrategyInfo<DataPathInfo>();
+  if (info == nullptr) {
+    return false;
+  }
+
+  auto it = info->isOnDataPath.find(face.getId());
+  return it != info->isOnDataPath.end() && it->second;
+}
+
+} // namespace fw
+} // namespace nfd
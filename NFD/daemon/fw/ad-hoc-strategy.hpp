@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_AD_HOC_STRATEGY_HPP
+#define NFD_DAEMON_FW_AD_HOC_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+#include <map>
+
+namespace nfd {
+namespace fw {
+
+/** \brief a forwarding strategy for ad hoc wireless faces, such as LoRa broadcast faces
+ *
+ *  This strategy forwards Interest to all FIB nexthops, like MulticastStrategy.
+ *  On an ad hoc face, however, a new Interest is not sent immediately: its transmission is
+ *  deferred by a random time, and cancelled if another node is overheard forwarding the same
+ *  Interest on that face in the meantime. This keeps the nodes sharing a wireless medium from
+ *  all relaying every Interest.
+ *
+ *  Nodes that recently retrieved Data for the namespace through the face are likely to be
+ *  closer to the producer, so they draw their deferral from the first half of the deferral
+ *  window, while other nodes draw it from the second half. A node that overhears the Data
+ *  being fetched by a neighbor learns that it is not on the Data path.
+ *
+ *  Retransmitted Interests are forwarded without deferral.
+ *
+ *  This strategy is the only layer that defers Interests. The LoRa transport defers and cancels
+ *  Data on broadcast faces by itself, but passes Interests to the radio as soon as they are sent
+ *  (see face::computeOverhearingKey), so that their deferral follows the Data path ranking.
+ *
+ *  \note This strategy is not EndpointId-aware.
+ */
+class AdHocStrategy : public Strategy
+                    , public ProcessNackTraits<AdHocStrategy>
+{
+public:
+  explicit
+  AdHocStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                             const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
+                   const FaceEndpoint& ingress, const Data& data) override;
+
+  void
+  afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /// StrategyInfo on pit::Entry
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1050;
+    }
+
+  public:
+    /// Interest transmissions waiting for their deferral, per outgoing face
+    std::map<FaceId, scheduler::ScopedEventId> deferredSends;
+  };
+
+  /// StrategyInfo on measurements::Entry
+  class DataPathInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1051;
+    }
+
+  public:
+    /// whether this node fetched the last Data received on each face, or overheard it
+    std::map<FaceId, bool> isOnDataPath;
+  };
+
+  /** \return time within which every node draws its deferral for sending \p interest on \p face
+   *
+   *  The window is long enough for a node that drew a shorter deferral to transmit the Interest
+   *  before the others expire their deferral.
+   */
+  static time::nanoseconds
+  getDeferralWindow(const Face& face, const Interest& interest);
+
+private:
+  void
+  deferInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outFace, const Interest& interest,
+                bool isOnDataPath);
+
+  bool
+  isOnDataPath(const pit::Entry& pitEntry, const Face& face);
+
+private:
+  friend ProcessNackTraits<AdHocStrategy>;
+  RetxSuppressionExponential m_retxSuppression;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+  static const time::milliseconds MIN_DEFERRAL_WINDOW;
+  static const time::seconds DATA_PATH_LIFETIME;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_AD_HOC_STRATEGY_HPP
@@ -150,6 +150,32 @@ findEligibleNextHopWithEarliestOutRecord(const Face& inFace, const Interest& int
   return found;
 }
 
+fib::NextHopList::const_iterator
+findEligibleNextHopWithLowestCost(const Face& inFace, const Interest& interest,
+                                  const fib::NextHopList& nexthops,
+                                  const shared_ptr<pit::Entry>& pitEntry,
+                                  bool wantUnused,
+                                  time::steady_clock::TimePoint now)
+{
+  auto found = nexthops.end();
+  double lowestEtx = 0.0;
+
+  for (auto it = nexthops.begin(); it != nexthops.end(); ++it) {
+    if (found != nexthops.end() && it->getCost() > found->getCost())
+      break;
+
+    if (!isNextHopEligible(inFace, interest, *it, pitEntry, wantUnused, now))
+      continue;
+
+    double etx = it->getFace().getLinkQuality().getEtx();
+    if (found == nexthops.end() || etx < lowestEtx) {
+      found = it;
+      lowestEtx = etx;
+    }
+  }
+  return found;
+}
+
 bool
 isNextHopEligible(const Face& inFace, const Interest& interest,
                   const fib::NextHop& nexthop,
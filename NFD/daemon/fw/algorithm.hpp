@@ -92,6 +92,23 @@ findEligibleNextHopWithEarliestOutRecord(const Face& inFace, const Interest& int
                                          const fib::NextHopList& nexthops,
                                          const shared_ptr<pit::Entry>& pitEntry);
 
+/** \brief pick an eligible NextHop with lowest cost
+ *
+ *  Among eligible nexthops of equal cost, the one whose face reports the lowest
+ *  expected transmission count (ETX) is picked, so that a lossy wireless link is avoided
+ *  when an equally good route exists. Faces without link quality measurements have an ETX of 1.
+ *
+ *  \param wantUnused if true, NextHop must not have unexpired out-record
+ *  \param now time::steady_clock::now(), ignored if !wantUnused
+ *  \note nexthops are assumed to be sorted by cost, as in a FIB entry
+ */
+fib::NextHopList::const_iterator
+findEligibleNextHopWithLowestCost(const Face& inFace, const Interest& interest,
+                                  const fib::NextHopList& nexthops,
+                                  const shared_ptr<pit::Entry>& pitEntry,
+                                  bool wantUnused = false,
+                                  time::steady_clock::TimePoint now = time::steady_clock::TimePoint::min());
+
 /** \brief determines whether a NextHop is eligible i.e. not the same inFace
  *  \param inFace incoming face of current Interest
  *  \param interest incoming Interest
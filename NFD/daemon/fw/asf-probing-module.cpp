@@ -35,6 +35,7 @@ namespace asf {
 
 constexpr time::milliseconds ProbingModule::DEFAULT_PROBING_INTERVAL;
 constexpr time::milliseconds ProbingModule::MIN_PROBING_INTERVAL;
+constexpr double ProbingModule::MAX_PROBE_AIRTIME_RATIO;
 
 static_assert(ProbingModule::DEFAULT_PROBING_INTERVAL < AsfMeasurements::MEASUREMENTS_LIFETIME,
               "ProbingModule::DEFAULT_PROBING_INTERVAL must be less than AsfMeasurements::MEASUREMENTS_LIFETIME");
@@ -81,6 +82,10 @@ ProbingModule::getFaceToProbe(const Face& inFace, const Interest& interest,
       continue;
     }
 
+    if (!canProbeWithinAirtime(hopFace, interest)) {
+      continue;
+    }
+
     FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest, hopFace.getId());
     // If no RTT has been recorded, probe this face
     if (info == nullptr || info->getLastRtt() == FaceInfo::RTT_NO_MEASUREMENT) {
@@ -118,7 +123,8 @@ ProbingModule::isProbingNeeded(const fib::Entry& fibEntry, const Interest& inter
 }
 
 void
-ProbingModule::afterForwardingProbe(const fib::Entry& fibEntry, const Interest& interest)
+ProbingModule::afterForwardingProbe(const fib::Entry& fibEntry, const Interest& interest,
+                                    const Face& faceProbed)
 {
   // After probing is done, need to set probing flag to false and
   // schedule another future probe
@@ -126,6 +132,19 @@ ProbingModule::afterForwardingProbe(const fib::Entry& fibEntry, const Interest&
   info.setIsProbingDue(false);
 
   scheduleProbe(fibEntry, m_probingInterval);
+
+  // Charge the airtime of the probe, including expected retransmissions, to the face
+  auto airtime = faceProbed.getTransport()->getTimeOnAir(interest.wireEncode().size()) *
+                 faceProbed.getLinkQuality().getEtx();
+  if (airtime > time::nanoseconds::zero()) {
+    auto now = time::steady_clock::now();
+    // forget faces whose budget has been replenished, including faces that no longer exist
+    for (auto it = m_nextProbeTime.begin(); it != m_nextProbeTime.end();) {
+      it = it->second <= now ? m_nextProbeTime.erase(it) : std::next(it);
+    }
+    m_nextProbeTime[faceProbed.getId()] = now + time::duration_cast<time::nanoseconds>(
+                                                  airtime / MAX_PROBE_AIRTIME_RATIO);
+  }
 }
 
 Face*
@@ -170,6 +189,25 @@ ProbingModule::getProbingProbability(uint64_t rank, uint64_t rankSum, uint64_t n
   return static_cast<double>(nFaces + 1 - rank) / rankSum;
 }
 
+bool
+ProbingModule::canProbeWithinAirtime(const Face& face, const Interest& interest)
+{
+  face::Transport* transport = face.getTransport();
+  if (transport->getTimeOnAir(interest.wireEncode().size()) == 0_ns) {
+    // probes on this face are cheap
+    return true;
+  }
+
+  // frames of this face waiting for the medium are already delayed, a probe would add to the
+  // backlog; frames of other faces sharing the medium (e.g., on the same radio) do not count
+  if (transport->getSendQueueLength() > 0) {
+    return false;
+  }
+
+  auto it = m_nextProbeTime.find(face.getId());
+  return it == m_nextProbeTime.end() || it->second <= time::steady_clock::now();
+}
+
 void
 ProbingModule::setProbingInterval(size_t probingInterval)
 {
@@ -28,11 +28,17 @@
 
 #include "asf-measurements.hpp"
 
+#include <unordered_map>
+
 namespace nfd {
 namespace fw {
 namespace asf {
 
 /** \brief ASF Probing Module
+ *
+ *  Probes on a face whose transport reports time-on-air (e.g., LoRa) take airtime from the
+ *  shared medium, so they are spread out to use at most MAX_PROBE_AIRTIME_RATIO of it, and
+ *  are not sent at all while frames of the face itself are waiting in its send queue.
  */
 class ProbingModule
 {
@@ -51,7 +57,7 @@ public:
   isProbingNeeded(const fib::Entry& fibEntry, const Interest& interest);
 
   void
-  afterForwardingProbe(const fib::Entry& fibEntry, const Interest& interest);
+  afterForwardingProbe(const fib::Entry& fibEntry, const Interest& interest, const Face& faceProbed);
 
   void
   setProbingInterval(size_t probingInterval);
@@ -88,13 +94,22 @@ private:
   static double
   getProbingProbability(uint64_t rank, uint64_t rankSum, uint64_t nFaces);
 
+  /** \return whether \p face can be probed with \p interest without exceeding its airtime budget
+   */
+  bool
+  canProbeWithinAirtime(const Face& face, const Interest& interest);
+
 public:
   static constexpr time::milliseconds DEFAULT_PROBING_INTERVAL = 1_min;
   static constexpr time::milliseconds MIN_PROBING_INTERVAL = 1_s;
+  /// fraction of the time a face with time-on-air may spend transmitting probes
+  static constexpr double MAX_PROBE_AIRTIME_RATIO = 0.01;
 
 private:
   time::milliseconds m_probingInterval;
   AsfMeasurements& m_measurements;
+  /// earliest time each face with time-on-air can be probed again
+  std::unordered_map<FaceId, time::steady_clock::TimePoint> m_nextProbeTime;
 };
 
 } // namespace asf
@@ -249,7 +249,7 @@ AsfStrategy::sendProbe(const Interest& interest, const FaceEndpoint& ingress, co
     return;
 
   forwardInterest(interest, *faceToProbe, fibEntry, pitEntry, true);
-  m_probing.afterForwardingProbe(fibEntry, interest);
+  m_probing.afterForwardingProbe(fibEntry, interest, *faceToProbe);
 }
 
 struct FaceStats
@@ -258,6 +258,8 @@ struct FaceStats
   time::nanoseconds rtt;
   time::nanoseconds srtt;
   uint64_t cost;
+  double etx;
+  time::nanoseconds airtime;
 };
 
 struct FaceStatsCompare
@@ -285,7 +287,9 @@ private:
       return time::nanoseconds::max() / 2;
     }
     else {
-      return stats.srtt;
+      // A lossy link needs several transmissions to deliver an Interest, and the airtime it takes
+      // on a shared medium is a cost to other traffic on top of the delay
+      return time::duration_cast<time::nanoseconds>(stats.srtt * stats.etx) + stats.airtime;
     }
   }
 };
@@ -303,13 +307,18 @@ AsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFa
       continue;
     }
 
-    FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest, nh.getFace().getId());
+    Face& face = nh.getFace();
+    double etx = face.getLinkQuality().getEtx();
+    auto airtime = time::duration_cast<time::nanoseconds>(
+                     face.getTransport()->getTimeOnAir(interest.wireEncode().size()) * etx);
+
+    FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest, face.getId());
     if (info == nullptr) {
-      rankedFaces.insert({&nh.getFace(), FaceInfo::RTT_NO_MEASUREMENT,
-                          FaceInfo::RTT_NO_MEASUREMENT, nh.getCost()});
+      rankedFaces.insert({&face, FaceInfo::RTT_NO_MEASUREMENT,
+                          FaceInfo::RTT_NO_MEASUREMENT, nh.getCost(), etx, airtime});
     }
     else {
-      rankedFaces.insert({&nh.getFace(), info->getLastRtt(), info->getSrtt(), nh.getCost()});
+      rankedFaces.insert({&face, info->getLastRtt(), info->getSrtt(), nh.getCost(), etx, airtime});
     }
   }
 
@@ -41,6 +41,10 @@ namespace asf {
  *       "An Experimental Investigation of Hyperbolic Routing with a Smart Forwarding Plane in NDN,"
  *       NDN Technical Report NDN-0042, 2016. http://named-data.net/techreports.html
  *
+ *  Faces are ranked by SRTT scaled by the expected transmission count (ETX) of the link, plus
+ *  the airtime an Interest takes on the medium, so that lossy and slow radio links are used only
+ *  when they are worth it. Probes are limited in airtime, see asf::ProbingModule.
+ *
  *  \note This strategy is not EndpointId-aware.
  */
 class AsfStrategy : public Strategy
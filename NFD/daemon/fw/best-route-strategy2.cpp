@@ -77,9 +77,7 @@ BestRouteStrategy2::afterReceiveInterest(const FaceEndpoint& ingress, const Inte
 
   if (suppression == RetxSuppressionResult::NEW) {
     // forward to nexthop with lowest cost except downstream
-    it = std::find_if(nexthops.begin(), nexthops.end(), [&] (const auto& nexthop) {
-      return isNextHopEligible(ingress.face, interest, nexthop, pitEntry);
-    });
+    it = findEligibleNextHopWithLowestCost(ingress.face, interest, nexthops, pitEntry);
 
     if (it == nexthops.end()) {
       NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
@@ -99,9 +97,8 @@ BestRouteStrategy2::afterReceiveInterest(const FaceEndpoint& ingress, const Inte
   }
 
   // find an unused upstream with lowest cost except downstream
-  it = std::find_if(nexthops.begin(), nexthops.end(), [&] (const auto& nexthop) {
-    return isNextHopEligible(ingress.face, interest, nexthop, pitEntry, true, time::steady_clock::now());
-  });
+  it = findEligibleNextHopWithLowestCost(ingress.face, interest, nexthops, pitEntry,
+                                         true, time::steady_clock::now());
 
   if (it != nexthops.end()) {
     auto egress = FaceEndpoint(it->getFace(), 0);
@@ -36,6 +36,8 @@ namespace fw {
 /** \brief Best Route strategy version 4
  *
  *  This strategy forwards a new Interest to the lowest-cost nexthop (except downstream).
+ *  Among nexthops of equal cost, the one whose link has the lowest expected transmission
+ *  count (ETX) is preferred.
  *  After that, if consumer retransmits the Interest (and is not suppressed according to
  *  exponential backoff algorithm), the strategy forwards the Interest again to
  *  the lowest-cost nexthop (except downstream) that is not previously used.
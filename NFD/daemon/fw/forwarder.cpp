@@ -32,12 +32,41 @@
 #include "common/logger.hpp"
 #include "table/cleanup.hpp"
 
+#include <ndn-cxx/lp/pit-token.hpp>
 #include <ndn-cxx/lp/tags.hpp>
 
 namespace nfd {
 
 NFD_LOG_INIT(Forwarder);
 
+/** \brief size of the PIT tokens issued by the forwarder on upstream faces
+ */
+static const size_t PIT_TOKEN_SIZE = sizeof(uint64_t);
+
+static shared_ptr<lp::PitToken>
+makePitToken(uint64_t token)
+{
+  uint8_t octets[PIT_TOKEN_SIZE];
+  for (size_t i = 0; i < PIT_TOKEN_SIZE; ++i) {
+    octets[i] = static_cast<uint8_t>(token >> (8 * (PIT_TOKEN_SIZE - 1 - i)));
+  }
+  ndn::Buffer buffer(octets, PIT_TOKEN_SIZE);
+  return make_shared<lp::PitToken>(std::make_pair(buffer.cbegin(), buffer.cend()));
+}
+
+static optional<uint64_t>
+parsePitToken(const lp::PitToken& pitToken)
+{
+  if (pitToken.size() != PIT_TOKEN_SIZE) {
+    return nullopt;
+  }
+  uint64_t token = 0;
+  for (uint8_t octet : pitToken) {
+    token = (token << 8) | octet;
+  }
+  return token;
+}
+
 static Name
 getDefaultStrategyName()
 {
@@ -131,6 +160,8 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
   if (hasDuplicateNonceInPit) {
     // goto Interest loop pipeline
     this->onInterestLoop(ingress, interest);
+    this->dispatchToStrategy(*pitEntry,
+      [&] (fw::Strategy& strategy) { strategy.afterReceiveLoopedInterest(ingress, interest, pitEntry); });
     return;
   }
 
@@ -235,8 +266,15 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry,
   // insert out-record
   pitEntry->insertOrUpdateOutRecord(egress.face, interest);
 
-  // send Interest
-  egress.face.sendInterest(interest, egress.endpoint);
+  // send Interest, with a PIT token identifying the PIT entry if the upstream returns it
+  if (egress.face.getLinkService()->allowsPitToken()) {
+    Interest tokenized(interest);
+    tokenized.setTag(makePitToken(m_pit.getToken(pitEntry)));
+    egress.face.sendInterest(tokenized, egress.endpoint);
+  }
+  else {
+    egress.face.sendInterest(interest, egress.endpoint);
+  }
   ++m_counters.nOutInterests;
 }
 
@@ -280,7 +318,7 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   }
 
   // PIT match
-  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  pit::DataMatchResult pitMatches = this->findDataMatches(data);
   if (pitMatches.size() == 0) {
     // goto Data unsolicited pipeline
     this->onDataUnsolicited(ingress, data);
@@ -361,6 +399,27 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   }
 }
 
+pit::DataMatchResult
+Forwarder::findDataMatches(const Data& data)
+{
+  auto pitToken = data.getTag<lp::PitToken>();
+  if (pitToken == nullptr) {
+    return m_pit.findAllDataMatches(data);
+  }
+  // the token belongs to this hop, and must not be cached or returned downstream
+  data.removeTag<lp::PitToken>();
+
+  auto token = parsePitToken(*pitToken);
+  if (!token) {
+    return m_pit.findAllDataMatches(data);
+  }
+  auto pitEntry = m_pit.findByToken(*token);
+  if (pitEntry == nullptr || !pitEntry->getInterest().matchesData(data)) {
+    return m_pit.findAllDataMatches(data);
+  }
+  return m_pit.findAllDataMatches(data, *pitEntry);
+}
+
 void
 Forwarder::onDataUnsolicited(const FaceEndpoint& ingress, const Data& data)
 {
@@ -568,23 +627,25 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, Face* upstream)
               pitEntry.dataFreshnessPeriod < m_deadNonceList.getLifetime();
   }
 
-  if (!needDnl) {
-    return;
-  }
+  // An Interest sent on an ad hoc face is also relayed by neighbors, and a slow relay may be
+  // overheard after the PIT entry is gone, so its Nonce is always remembered to stop the loop
+  auto insertNonce = [&] (const pit::OutRecord& outRecord) {
+    if (needDnl || outRecord.getFace().getLinkType() == ndn::nfd::LINK_TYPE_AD_HOC) {
+      m_deadNonceList.add(pitEntry.getName(), outRecord.getLastNonce());
+    }
+  };
 
   // Dead Nonce List insert
   if (upstream == nullptr) {
     // insert all outgoing Nonces
     const auto& outRecords = pitEntry.getOutRecords();
-    std::for_each(outRecords.begin(), outRecords.end(), [&] (const auto& outRecord) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord.getLastNonce());
-    });
+    std::for_each(outRecords.begin(), outRecords.end(), insertNonce);
   }
   else {
     // insert outgoing Nonce of a specific face
     auto outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      insertNonce(*outRecord);
     }
   }
 }
@@ -204,6 +204,18 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onIncomingData(const FaceEndpoint& ingress, const Data& data);
 
+  /** \brief finds the PIT entries satisfied by \p data
+   *
+   *  Interests sent on faces that allow PIT tokens carry a token issued by the PIT, which
+   *  the upstream returns in the Data. A valid token locates one matching PIT entry without
+   *  a name lookup, from which the other matching entries are collected. The token is removed
+   *  from \p data. Without a valid token, the Data is matched by name.
+   *
+   *  \return all PIT entries matching \p data
+   */
+  pit::DataMatchResult
+  findDataMatches(const Data& data);
+
   /** \brief Data unsolicited pipeline
    */
   VIRTUAL_WITH_TESTS void
@@ -238,6 +250,9 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
 
   /** \brief insert Nonce to Dead Nonce List if necessary
+   *
+   *  Nonces of out-records on ad hoc faces are always inserted.
+   *
    *  \param upstream if null, insert Nonces from all out-records;
    *                  if not null, insert Nonce only on the out-records of this face
    */
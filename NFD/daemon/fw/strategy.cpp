@@ -180,6 +180,13 @@ Strategy::afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
   this->sendDataToAll(pitEntry, ingress, data);
 }
 
+void
+Strategy::afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                     const shared_ptr<pit::Entry>& pitEntry)
+{
+  NFD_LOG_DEBUG("afterReceiveLoopedInterest in=" << ingress << " pitEntry=" << pitEntry->getName());
+}
+
 void
 Strategy::afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
                            const shared_ptr<pit::Entry>& pitEntry)
@@ -151,6 +151,26 @@ public: // triggers
   afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
                        const shared_ptr<pit::Entry>& pitEntry) = 0;
 
+  /** \brief trigger after a looped Interest is received
+   *
+   *  The Interest:
+   *  - does not violate Scope
+   *  - IS looped, i.e., its Nonce is already recorded in the PIT entry
+   *  - is under a namespace managed by this strategy
+   *
+   *  On a multi-access or ad hoc face, a looped Interest is often another node forwarding
+   *  the same Interest on the shared medium. The strategy can use this to cancel its own
+   *  pending transmission of the Interest.
+   *
+   *  In the base class this method does nothing.
+   *
+   *  \warning The strategy must not retain shared_ptr<pit::Entry>, otherwise undefined behavior
+   *           may occur. However, the strategy is allowed to store weak_ptr<pit::Entry>.
+   */
+  virtual void
+  afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                             const shared_ptr<pit::Entry>& pitEntry);
+
   /** \brief trigger before PIT entry is satisfied
    *
    *  This trigger is invoked when an incoming Data satisfies more than one PIT entry.
@@ -29,6 +29,7 @@
 namespace nfd {
 
 const size_t TablesConfigSection::DEFAULT_CS_MAX_PACKETS = 65536;
+const size_t TablesConfigSection::DEFAULT_CS_PERSISTENT_MAX_SIZE = 64 * 1024 * 1024;
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
@@ -51,6 +52,7 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_forwarder.getCs().setLimitBytes(std::numeric_limits<size_t>::max());
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
@@ -66,6 +68,12 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     nCsMaxPackets = ConfigFile::parseNumber<size_t>(*csMaxPacketsNode, "cs_max_packets", "tables");
   }
 
+  size_t nCsMaxBytes = std::numeric_limits<size_t>::max();
+  OptionalConfigSection csMaxBytesNode = section.get_child_optional("cs_max_bytes");
+  if (csMaxBytesNode) {
+    nCsMaxBytes = ConfigFile::parseNumber<size_t>(*csMaxBytesNode, "cs_max_bytes", "tables");
+  }
+
   unique_ptr<cs::Policy> csPolicy;
   OptionalConfigSection csPolicyNode = section.get_child_optional("cs_policy");
   if (csPolicyNode) {
@@ -76,6 +84,22 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     }
   }
 
+  optional<std::string> csPersistentPath;
+  OptionalConfigSection csPersistentPathNode = section.get_child_optional("cs_persistent_path");
+  if (csPersistentPathNode) {
+    csPersistentPath = csPersistentPathNode->get_value<std::string>();
+    if (csPersistentPath->empty()) {
+      NDN_THROW(ConfigFile::Error("Invalid value for option 'cs_persistent_path' in section 'tables'"));
+    }
+  }
+
+  size_t csPersistentMaxSize = DEFAULT_CS_PERSISTENT_MAX_SIZE;
+  OptionalConfigSection csPersistentMaxSizeNode = section.get_child_optional("cs_persistent_max_size");
+  if (csPersistentMaxSizeNode) {
+    csPersistentMaxSize = ConfigFile::parseNumber<size_t>(*csPersistentMaxSizeNode,
+                                                          "cs_persistent_max_size", "tables");
+  }
+
   unique_ptr<fw::UnsolicitedDataPolicy> unsolicitedDataPolicy;
   OptionalConfigSection unsolicitedDataPolicyNode = section.get_child_optional("cs_unsolicited_policy");
   if (unsolicitedDataPolicyNode) {
@@ -105,9 +129,18 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
 
   Cs& cs = m_forwarder.getCs();
   cs.setLimit(nCsMaxPackets);
+  cs.setLimitBytes(nCsMaxBytes);
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
+  if (cs.size() == 0 && cs.getPersistentStore() == nullptr && csPersistentPath) {
+    try {
+      cs.setPersistentStore(make_unique<cs::PersistentStore>(*csPersistentPath, csPersistentMaxSize));
+    }
+    catch (const cs::PersistentStore::Error& e) {
+      NDN_THROW(ConfigFile::Error(std::string(e.what()) + " in section 'tables'"));
+    }
+  }
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
@@ -38,8 +38,11 @@ namespace nfd {
  *  tables
  *  {
  *    cs_max_packets 65536
+ *    cs_max_bytes 33554432
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
+ *    cs_persistent_path /var/cache/ndn/nfd-cs.db
+ *    cs_persistent_max_size 67108864
  *
  *    strategy_choice
  *    {
@@ -58,8 +61,10 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_max_bytes, cs_policy, and cs_unsolicited_policy are applied;
  *      defaults are used if an option is omitted.
+ *  \li cs_persistent_path and cs_persistent_max_size are only applied while the Content Store
+ *      is empty and has no persistent store, i.e., at startup.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
@@ -93,6 +98,7 @@ private:
 
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
+  static const size_t DEFAULT_CS_PERSISTENT_MAX_SIZE;
 
   Forwarder& m_forwarder;
 
@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-arena.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace nfd {
+namespace cs {
+
+constexpr size_t SlabArena::SLAB_SIZE;
+constexpr size_t SlabArena::MAX_BLOCK_SIZE;
+
+/** \brief block sizes of the size classes, spaced by a factor of 1.25 to 1.5
+ *
+ *  Above 2 KiB, each block size is the largest multiple of 8 such that a whole number of blocks
+ *  (31, 21, 15, 10, 7, 5 and 4) fills the part of the slab after its header, so that a slab of
+ *  large blocks does not waste a large fraction of its size. Smaller size classes waste at most
+ *  960 octets per slab.
+ */
+static constexpr size_t SIZE_CLASSES[] = {
+  64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2112, 3112, 4360, 6544, 9352, 13088, 16368
+};
+
+/** \brief header at the beginning of a slab, followed by its blocks
+ */
+struct SlabArena::Slab
+{
+  Slab* prev;
+  Slab* next;
+  uint8_t* freeBlocks; ///< singly linked list of freed blocks
+  uint32_t sizeClass;
+  uint32_t nUsed;
+  uint32_t nCarved; ///< number of blocks handed out at least once
+  uint32_t capacity;
+};
+
+/** \brief offset of the first block in a slab, leaving room for the header
+ */
+static constexpr size_t SLAB_HEADER_SIZE = 64;
+
+void
+SlabArena::SlabList::pushFront(Slab* slab)
+{
+  slab->prev = nullptr;
+  slab->next = head;
+  if (head != nullptr) {
+    head->prev = slab;
+  }
+  head = slab;
+}
+
+void
+SlabArena::SlabList::remove(Slab* slab)
+{
+  if (slab->prev != nullptr) {
+    slab->prev->next = slab->next;
+  }
+  else {
+    head = slab->next;
+  }
+  if (slab->next != nullptr) {
+    slab->next->prev = slab->prev;
+  }
+}
+
+SlabArena::SlabArena()
+{
+  static_assert(sizeof(SIZE_CLASSES) / sizeof(SIZE_CLASSES[0]) == N_SIZE_CLASSES, "");
+  static_assert(sizeof(Slab) <= SLAB_HEADER_SIZE, "");
+  static_assert(SIZE_CLASSES[N_SIZE_CLASSES - 1] == MAX_BLOCK_SIZE, "");
+}
+
+SlabArena::~SlabArena()
+{
+  for (auto lists : {&m_partialSlabs, &m_fullSlabs}) {
+    for (SlabList& list : *lists) {
+      while (list.head != nullptr) {
+        Slab* slab = list.head;
+        list.head = slab->next;
+        std::free(slab);
+      }
+    }
+  }
+  for (Slab* slab : m_emptySlabs) {
+    std::free(slab);
+  }
+}
+
+size_t
+SlabArena::getSizeClass(size_t size)
+{
+  BOOST_ASSERT(size <= MAX_BLOCK_SIZE);
+  return std::lower_bound(std::begin(SIZE_CLASSES), std::end(SIZE_CLASSES), size) -
+         std::begin(SIZE_CLASSES);
+}
+
+size_t
+SlabArena::getBlockSize(size_t size)
+{
+  return size > MAX_BLOCK_SIZE ? size : SIZE_CLASSES[getSizeClass(size)];
+}
+
+SlabArena::Slab*
+SlabArena::makeSlab(size_t sizeClass)
+{
+  void* memory = nullptr;
+  if (::posix_memalign(&memory, SLAB_SIZE, SLAB_SIZE) != 0) {
+    throw std::bad_alloc();
+  }
+  ++m_nSlabs;
+
+  auto slab = static_cast<Slab*>(memory);
+  slab->freeBlocks = nullptr;
+  slab->sizeClass = static_cast<uint32_t>(sizeClass);
+  slab->nUsed = 0;
+  slab->nCarved = 0;
+  slab->capacity = static_cast<uint32_t>((SLAB_SIZE - SLAB_HEADER_SIZE) / SIZE_CLASSES[sizeClass]);
+  m_partialSlabs[sizeClass].pushFront(slab);
+  return slab;
+}
+
+uint8_t*
+SlabArena::allocate(size_t size)
+{
+  if (size > MAX_BLOCK_SIZE) {
+    m_nHeapBytes += size;
+    return new uint8_t[size];
+  }
+
+  size_t sizeClass = getSizeClass(size);
+  Slab* slab = m_partialSlabs[sizeClass].head;
+  if (slab == nullptr) {
+    slab = m_emptySlabs[sizeClass];
+    if (slab != nullptr) {
+      m_emptySlabs[sizeClass] = nullptr;
+      m_partialSlabs[sizeClass].pushFront(slab);
+    }
+    else {
+      slab = makeSlab(sizeClass);
+    }
+  }
+
+  uint8_t* block = nullptr;
+  if (slab->freeBlocks != nullptr) {
+    block = slab->freeBlocks;
+    std::memcpy(&slab->freeBlocks, block, sizeof(uint8_t*));
+  }
+  else {
+    block = reinterpret_cast<uint8_t*>(slab) + SLAB_HEADER_SIZE +
+            slab->nCarved * SIZE_CLASSES[sizeClass];
+    ++slab->nCarved;
+  }
+
+  if (slab->nUsed++ == 0) {
+    ++m_nOccupiedSlabs;
+  }
+  if (slab->nUsed == slab->capacity) {
+    m_partialSlabs[sizeClass].remove(slab);
+    m_fullSlabs[sizeClass].pushFront(slab);
+  }
+  return block;
+}
+
+void
+SlabArena::deallocate(uint8_t* block, size_t size)
+{
+  if (size > MAX_BLOCK_SIZE) {
+    m_nHeapBytes -= size;
+    delete[] block;
+    return;
+  }
+
+  auto slab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(block) & ~(SLAB_SIZE - 1));
+  BOOST_ASSERT(slab->sizeClass == getSizeClass(size));
+  BOOST_ASSERT(slab->nUsed > 0);
+
+  if (slab->nUsed == slab->capacity) {
+    m_fullSlabs[slab->sizeClass].remove(slab);
+    m_partialSlabs[slab->sizeClass].pushFront(slab);
+  }
+
+  std::memcpy(block, &slab->freeBlocks, sizeof(uint8_t*));
+  slab->freeBlocks = block;
+
+  if (--slab->nUsed == 0) {
+    --m_nOccupiedSlabs;
+    m_partialSlabs[slab->sizeClass].remove(slab);
+    if (m_emptySlabs[slab->sizeClass] == nullptr) {
+      m_emptySlabs[slab->sizeClass] = slab;
+    }
+    else {
+      std::free(slab);
+      --m_nSlabs;
+    }
+  }
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_ARENA_HPP
+#define NFD_DAEMON_TABLE_CS_ARENA_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+
+namespace nfd {
+namespace cs {
+
+/** \brief allocates the wire encodings of Content Store entries from slabs
+ *
+ *  A slab is a fixed-size, aligned chunk of memory that is carved into blocks of a single size
+ *  class. Data packets are thus stored contiguously, without a heap allocation per packet.
+ *  Wire encodings larger than the largest size class are allocated from the heap.
+ *
+ *  A slab is only released when all its blocks are free, so after evictions many slabs may be
+ *  partially used. getOccupiedBytes() therefore counts whole slabs rather than blocks, and the
+ *  Content Store enforces its byte limit against that value. The Entry objects and the index
+ *  nodes of the Content Store are allocated elsewhere and are not counted.
+ *
+ *  When the last block of a slab is freed, the slab is kept for reuse if its size class has no
+ *  other empty slab, so that a workload oscillating around a slab boundary does not repeatedly
+ *  allocate and release the same slab. Empty slabs are not counted by getOccupiedBytes(); there
+ *  is at most one per size class.
+ */
+class SlabArena : noncopyable
+{
+public:
+  SlabArena();
+
+  ~SlabArena();
+
+  /** \brief allocates a block of at least \p size octets
+   */
+  uint8_t*
+  allocate(size_t size);
+
+  /** \brief releases a block
+   *  \param block a block returned by allocate()
+   *  \param size the size passed to allocate()
+   */
+  void
+  deallocate(uint8_t* block, size_t size);
+
+  /** \return number of octets occupied by a block allocated for \p size octets
+   */
+  static size_t
+  getBlockSize(size_t size);
+
+  /** \return number of slabs currently allocated, including empty slabs kept for reuse
+   */
+  size_t
+  getNSlabs() const
+  {
+    return m_nSlabs;
+  }
+
+  /** \return octets held for the allocated blocks: the size of the slabs that contain at least
+   *          one allocated block, plus the size of the blocks allocated from the heap
+   */
+  size_t
+  getOccupiedBytes() const
+  {
+    return m_nOccupiedSlabs * SLAB_SIZE + m_nHeapBytes;
+  }
+
+public:
+  /** \brief size and alignment of a slab
+   */
+  static constexpr size_t SLAB_SIZE = 64 * 1024;
+
+  /** \brief largest block allocated from a slab
+   *
+   *  Four such blocks fill the part of a slab that follows its header.
+   */
+  static constexpr size_t MAX_BLOCK_SIZE = 16368;
+
+private:
+  struct Slab;
+
+  /** \brief a doubly linked list of slabs
+   */
+  struct SlabList
+  {
+    Slab* head = nullptr;
+
+    void
+    pushFront(Slab* slab);
+
+    void
+    remove(Slab* slab);
+  };
+
+  static constexpr size_t N_SIZE_CLASSES = 17;
+
+  static size_t
+  getSizeClass(size_t size);
+
+  Slab*
+  makeSlab(size_t sizeClass);
+
+private:
+  /// slabs that have free blocks, by size class
+  std::array<SlabList, N_SIZE_CLASSES> m_partialSlabs;
+  /// slabs without free blocks, by size class
+  std::array<SlabList, N_SIZE_CLASSES> m_fullSlabs;
+  /// an empty slab kept for reuse, by size class
+  std::array<Slab*, N_SIZE_CLASSES> m_emptySlabs{};
+  size_t m_nSlabs = 0;
+  size_t m_nOccupiedSlabs = 0;
+  size_t m_nHeapBytes = 0;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_ARENA_HPP
@@ -24,17 +24,114 @@
  */
 
 #include "cs-entry.hpp"
+#include "name-tree-hashtable.hpp"
+
+#include <ndn-cxx/util/sha256.hpp>
+
+#include <cstring>
 
 namespace nfd {
 namespace cs {
 
-Entry::Entry(shared_ptr<const Data> data, bool isUnsolicited)
-  : m_data(std::move(data))
+Entry::Entry(const Data& data, bool isUnsolicited)
+  : m_wire(data.wireEncode().wire())
+  , m_wireSize(data.wireEncode().size())
+  , m_name(data.getName())
+  , m_freshnessPeriod(data.getFreshnessPeriod())
   , m_isUnsolicited(isUnsolicited)
 {
   updateFreshUntil();
 }
 
+/** \brief find a top-level element of an encoded Data packet
+ *  \return a copy of the element, or nullopt if the packet does not contain \p type
+ *  \throw tlv::Error the TLV framing is malformed
+ */
+static optional<Block>
+findElement(const uint8_t* wire, size_t wireSize, uint32_t type)
+{
+  const uint8_t* pos = wire;
+  const uint8_t* end = wire + wireSize;
+  tlv::readType(pos, end);
+  if (tlv::readVarNumber(pos, end) != static_cast<uint64_t>(end - pos)) {
+    NDN_THROW(tlv::Error("Data length does not match the wire encoding"));
+  }
+
+  while (pos < end) {
+    const uint8_t* element = pos;
+    uint32_t elementType = tlv::readType(pos, end);
+    uint64_t length = tlv::readVarNumber(pos, end);
+    if (length > static_cast<uint64_t>(end - pos)) {
+      NDN_THROW(tlv::Error("Element length exceeds the Data packet"));
+    }
+    pos += length;
+    if (elementType == type) {
+      return Block(element, static_cast<size_t>(pos - element));
+    }
+  }
+  return nullopt;
+}
+
+static Name
+decodeName(const uint8_t* wire, size_t wireSize)
+{
+  auto name = findElement(wire, wireSize, tlv::Name);
+  if (!name) {
+    NDN_THROW(tlv::Error("Data does not contain a Name"));
+  }
+  return Name(*name);
+}
+
+static time::milliseconds
+decodeFreshnessPeriod(const uint8_t* wire, size_t wireSize)
+{
+  auto metaInfo = findElement(wire, wireSize, tlv::MetaInfo);
+  if (!metaInfo) {
+    return 0_ms;
+  }
+  return ndn::MetaInfo(*metaInfo).getFreshnessPeriod();
+}
+
+Entry::Entry(const uint8_t* wire, size_t wireSize, bool isUnsolicited)
+  : m_wire(wire)
+  , m_wireSize(wireSize)
+  , m_name(decodeName(wire, wireSize))
+  , m_freshnessPeriod(decodeFreshnessPeriod(wire, wireSize))
+  , m_isUnsolicited(isUnsolicited)
+{
+  updateFreshUntil();
+}
+
+void
+Entry::setWire(const uint8_t* wire)
+{
+  m_wire = wire;
+  const Block& name = m_name.wireEncode();
+  m_name = Name(Block(name.wire(), name.size()));
+}
+
+shared_ptr<const Data>
+Entry::getData() const
+{
+  return make_shared<Data>(Block(m_wire, m_wireSize));
+}
+
+const ndn::Buffer&
+Entry::getDigest() const
+{
+  if (m_digest == nullptr) {
+    m_digest = ndn::util::Sha256::computeDigest(m_wire, m_wireSize);
+  }
+  return *m_digest;
+}
+
+Name
+Entry::getFullName() const
+{
+  getDigest();
+  return Name(m_name).appendImplicitSha256Digest(m_digest);
+}
+
 bool
 Entry::isFresh() const
 {
@@ -44,17 +141,37 @@ Entry::isFresh() const
 void
 Entry::updateFreshUntil()
 {
-  m_freshUntil = time::steady_clock::now() + m_data->getFreshnessPeriod();
+  m_freshUntil = time::steady_clock::now() + m_freshnessPeriod;
+}
+
+/** \brief compares an implicit digest component with a digest, like name::Component::compare
+ */
+static int
+compareDigest(const name::Component& component, const ndn::Buffer& digest)
+{
+  if (component.value_size() != digest.size()) {
+    return component.value_size() < digest.size() ? -1 : 1;
+  }
+  return std::memcmp(component.value(), digest.data(), digest.size());
 }
 
 bool
 Entry::canSatisfy(const Interest& interest) const
 {
-  if (!interest.matchesData(*m_data)) {
+  const Name& interestName = interest.getName();
+  if (interestName.size() == m_name.size() + 1) {
+    // Interest Name can only match the full Name
+    if (!interestName[-1].isImplicitSha256Digest() ||
+        interestName.compare(0, m_name.size(), m_name) != 0 ||
+        compareDigest(interestName[-1], getDigest()) != 0) {
+      return false;
+    }
+  }
+  else if (interest.getCanBePrefix() ? !interestName.isPrefixOf(m_name) : interestName != m_name) {
     return false;
   }
 
-  if (interest.getMustBeFresh() && !this->isFresh()) {
+  if (interest.getMustBeFresh() && (m_freshnessPeriod <= 0_ms || !this->isFresh())) {
     return false;
   }
 
@@ -62,20 +179,20 @@ Entry::canSatisfy(const Interest& interest) const
 }
 
 static int
-compareQueryWithData(const Name& queryName, const Data& data)
+compareQueryWithEntry(const Name& queryName, const Entry& entry)
 {
   bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
 
   int cmp = queryIsFullName ?
-            queryName.compare(0, queryName.size() - 1, data.getName()) :
-            queryName.compare(data.getName());
+            queryName.compare(0, queryName.size() - 1, entry.getName()) :
+            queryName.compare(entry.getName());
 
   if (cmp != 0) { // Name without digest differs
     return cmp;
   }
 
   if (queryIsFullName) { // Name without digest equals, compare digest
-    return queryName[-1].compare(data.getFullName()[-1]);
+    return compareDigest(queryName[-1], entry.getDigest());
   }
   else { // queryName is a proper prefix of Data fullName
     return -1;
@@ -83,32 +200,38 @@ compareQueryWithData(const Name& queryName, const Data& data)
 }
 
 static int
-compareDataWithData(const Data& lhs, const Data& rhs)
+compareEntryWithEntry(const Entry& lhs, const Entry& rhs)
 {
   int cmp = lhs.getName().compare(rhs.getName());
   if (cmp != 0) {
     return cmp;
   }
 
-  return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
+  return std::memcmp(lhs.getDigest().data(), rhs.getDigest().data(), lhs.getDigest().size());
 }
 
 bool
 operator<(const Entry& entry, const Name& queryName)
 {
-  return compareQueryWithData(queryName, entry.getData()) > 0;
+  return compareQueryWithEntry(queryName, entry) > 0;
 }
 
 bool
 operator<(const Name& queryName, const Entry& entry)
 {
-  return compareQueryWithData(queryName, entry.getData()) < 0;
+  return compareQueryWithEntry(queryName, entry) < 0;
 }
 
 bool
 operator<(const Entry& lhs, const Entry& rhs)
 {
-  return compareDataWithData(lhs.getData(), rhs.getData()) < 0;
+  return compareEntryWithEntry(lhs, rhs) < 0;
+}
+
+size_t
+NameHash::operator()(const Name& name) const
+{
+  return name_tree::computeHash(name);
 }
 
 } // namespace cs
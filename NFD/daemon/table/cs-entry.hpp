@@ -28,36 +28,59 @@
 
 #include "core/common.hpp"
 
+#include <unordered_map>
+
 namespace nfd {
 namespace cs {
 
 /** \brief a ContentStore entry
+ *
+ *  An entry keeps the wire encoding of the Data packet, together with its name and the fields
+ *  needed to match Interests. The Data packet is only decoded when it is retrieved.
  */
 class Entry
 {
 public: // exposed through ContentStore enumeration
-  /** \brief return the stored Data
+  /** \brief decode the stored Data
    */
-  const Data&
-  getData() const
-  {
-    return *m_data;
-  }
+  shared_ptr<const Data>
+  getData() const;
 
   /** \brief return stored Data name
    */
   const Name&
   getName() const
   {
-    return m_data->getName();
+    return m_name;
   }
 
   /** \brief return full name (including implicit digest) of the stored Data
    */
-  const Name&
-  getFullName() const
+  Name
+  getFullName() const;
+
+  /** \brief return the wire encoding of the stored Data
+   */
+  const uint8_t*
+  getWire() const
   {
-    return m_data->getFullName();
+    return m_wire;
+  }
+
+  /** \brief return the size of the wire encoding of the stored Data
+   */
+  size_t
+  getWireSize() const
+  {
+    return m_wireSize;
+  }
+
+  /** \brief return FreshnessPeriod of the stored Data
+   */
+  time::milliseconds
+  getFreshnessPeriod() const
+  {
+    return m_freshnessPeriod;
   }
 
   /** \brief return whether the stored Data is unsolicited
@@ -74,18 +97,48 @@ public: // exposed through ContentStore enumeration
   isFresh() const;
 
   /** \brief determine whether Interest can be satisified by the stored Data
+   *
+   *  This is equivalent to `interest.matchesData(*getData())` followed by a freshness check,
+   *  without decoding the Data.
    */
   bool
   canSatisfy(const Interest& interest) const;
 
 public: // used by ContentStore implementation
-  Entry(shared_ptr<const Data> data, bool isUnsolicited);
+  /** \brief create an entry that refers to the wire encoding of \p data
+   *  \warning The entry is only valid as long as \p data, unless setWire() is called.
+   */
+  Entry(const Data& data, bool isUnsolicited);
+
+  /** \brief create an entry that refers to \p wire, an encoded Data packet of \p wireSize octets
+   *
+   *  Only the Name and MetaInfo elements are copied out of \p wire.
+   *
+   *  \warning The entry is only valid as long as \p wire, unless setWire() is called.
+   *  \throw tlv::Error \p wire does not contain a Name
+   */
+  Entry(const uint8_t* wire, size_t wireSize, bool isUnsolicited);
+
+  /** \brief move the wire encoding to \p wire, which holds a copy of getWire()
+   *
+   *  The name is copied as well, so that the entry no longer refers to the original buffer.
+   */
+  void
+  setWire(const uint8_t* wire);
 
   /** \brief recalculate when the entry would become non-fresh, relative to current time
    */
   void
   updateFreshUntil();
 
+  /** \brief set when the entry becomes non-fresh
+   */
+  void
+  setFreshUntil(time::steady_clock::TimePoint freshUntil)
+  {
+    m_freshUntil = freshUntil;
+  }
+
   /** \brief clear 'unsolicited' flag
    */
   void
@@ -94,8 +147,17 @@ public: // used by ContentStore implementation
     m_isUnsolicited = false;
   }
 
+  /** \brief return the implicit SHA-256 digest of the stored Data, computing it if needed
+   */
+  const ndn::Buffer&
+  getDigest() const;
+
 private:
-  shared_ptr<const Data> m_data;
+  const uint8_t* m_wire;
+  size_t m_wireSize;
+  Name m_name;
+  mutable ndn::ConstBufferPtr m_digest;
+  time::milliseconds m_freshnessPeriod;
   bool m_isUnsolicited;
   time::steady_clock::TimePoint m_freshUntil;
 };
@@ -121,6 +183,21 @@ operator<(Table::const_iterator lhs, Table::const_iterator rhs)
   return *lhs < *rhs;
 }
 
+/** \brief hash function of Data names in NameIndex
+ */
+struct NameHash
+{
+  size_t
+  operator()(const Name& name) const;
+};
+
+/** \brief an index from Data name (without implicit digest) to the first Table entry with that name
+ *
+ *  Entries with the same name differ only in their implicit digests, and are adjacent in Table.
+ *  This index allows exact-name lookups without comparing names along a path of the Table.
+ */
+using NameIndex = std::unordered_map<Name, Table::const_iterator, NameHash>;
+
 } // namespace cs
 } // namespace nfd
 
@@ -0,0 +1,272 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-persistent-store.hpp"
+#include "common/logger.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace cs {
+
+NFD_LOG_INIT(CsPersistentStore);
+
+const char FILE_MAGIC[8] = {'N', 'F', 'D', '-', 'C', 'S', '0', '1'};
+
+struct PersistentStore::FileHeader
+{
+  char magic[8];
+  uint64_t tail; ///< end of the last record
+};
+
+struct PersistentStore::RecordHeader
+{
+  uint32_t wireSize;
+  uint32_t isLive;
+  int64_t freshUntil; ///< in milliseconds since the Unix epoch
+};
+
+size_t
+PersistentStore::getRecordSize(size_t wireSize)
+{
+  return sizeof(RecordHeader) + ((wireSize + 7) & ~size_t(7));
+}
+
+PersistentStore::PersistentStore(const std::string& path, size_t maxSize)
+  : m_path(path)
+  , m_size(maxSize)
+{
+  if (maxSize < sizeof(FileHeader) + sizeof(RecordHeader)) {
+    NDN_THROW(Error("Content Store file size " + to_string(maxSize) + " is too small"));
+  }
+
+  m_fd = ::open(path.data(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (m_fd < 0) {
+    NDN_THROW(Error("Cannot open Content Store file " + path + ": " + std::strerror(errno)));
+  }
+
+  if (::ftruncate(m_fd, static_cast<off_t>(m_size)) < 0) {
+    int error = errno;
+    ::close(m_fd);
+    NDN_THROW(Error("Cannot resize Content Store file " + path + ": " + std::strerror(error)));
+  }
+
+  void* map = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    int error = errno;
+    ::close(m_fd);
+    NDN_THROW(Error("Cannot map Content Store file " + path + ": " + std::strerror(error)));
+  }
+  m_map = static_cast<uint8_t*>(map);
+
+  auto header = reinterpret_cast<FileHeader*>(m_map);
+  if (std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+      header->tail < sizeof(FileHeader)) {
+    NFD_LOG_INFO("Initializing " << path);
+    std::memcpy(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    setTail(sizeof(FileHeader));
+  }
+  else {
+    // records beyond the end of a shrunk file are lost
+    m_tail = std::min<size_t>(header->tail, m_size);
+  }
+}
+
+PersistentStore::~PersistentStore()
+{
+  this->flush();
+  ::munmap(m_map, m_size);
+  ::close(m_fd);
+}
+
+PersistentStore::RecordHeader*
+PersistentStore::getRecord(size_t offset) const
+{
+  return reinterpret_cast<RecordHeader*>(m_map + offset);
+}
+
+void
+PersistentStore::setTail(size_t tail)
+{
+  m_tail = tail;
+  reinterpret_cast<FileHeader*>(m_map)->tail = tail;
+}
+
+std::vector<PersistentStore::Record>
+PersistentStore::load()
+{
+  std::vector<Record> records;
+  m_records.clear();
+  m_offsets.clear();
+
+  size_t in = sizeof(FileHeader);
+  size_t out = sizeof(FileHeader);
+  while (in + sizeof(RecordHeader) <= m_tail) {
+    const RecordHeader* record = getRecord(in);
+    size_t recordSize = getRecordSize(record->wireSize);
+    if (record->wireSize == 0 || in + recordSize > m_tail) {
+      NFD_LOG_WARN("Truncated record at offset " << in << " in " << m_path);
+      break;
+    }
+
+    if (record->isLive) {
+      const uint8_t* wire = m_map + in + sizeof(RecordHeader);
+      const uint8_t* pos = wire;
+      const uint8_t* end = wire + record->wireSize;
+      uint32_t type = 0;
+      uint64_t length = 0;
+      if (!tlv::readType(pos, end, type) || type != tlv::Data ||
+          !tlv::readVarNumber(pos, end, length) || length != static_cast<uint64_t>(end - pos)) {
+        NFD_LOG_WARN("Malformed record at offset " << in << " in " << m_path);
+      }
+      else {
+        if (out != in) {
+          std::memmove(m_map + out, m_map + in, recordSize);
+        }
+        // the moved header is read, as the source may have been overwritten
+        const RecordHeader* moved = getRecord(out);
+        records.push_back({out, m_map + out + sizeof(RecordHeader), moved->wireSize,
+                           time::fromUnixTimestamp(time::milliseconds(moved->freshUntil))});
+        m_records.emplace(out, nullptr);
+        out += recordSize;
+      }
+    }
+    in += recordSize;
+  }
+
+  setTail(out);
+  NFD_LOG_DEBUG("load " << records.size() << " records, " << (in - out) << " octets reclaimed");
+  return records;
+}
+
+void
+PersistentStore::bind(const Record& record, const Entry& entry)
+{
+  BOOST_ASSERT(m_records.count(record.offset) > 0);
+  m_records[record.offset] = &entry;
+  m_offsets[&entry] = record.offset;
+}
+
+void
+PersistentStore::discard(const Record& record)
+{
+  BOOST_ASSERT(m_records.count(record.offset) > 0);
+  getRecord(record.offset)->isLive = 0;
+  m_records.erase(record.offset);
+}
+
+void
+PersistentStore::insert(const Entry& entry, time::system_clock::TimePoint freshUntil)
+{
+  if (m_offsets.count(&entry) > 0) {
+    this->refresh(entry, freshUntil);
+    return;
+  }
+
+  size_t recordSize = getRecordSize(entry.getWireSize());
+  if (m_tail + recordSize > m_size) {
+    this->compact();
+    if (m_tail + recordSize > m_size) {
+      NFD_LOG_DEBUG("insert " << entry.getName() << " file-full");
+      return;
+    }
+  }
+
+  std::memcpy(m_map + m_tail + sizeof(RecordHeader), entry.getWire(), entry.getWireSize());
+  RecordHeader* record = getRecord(m_tail);
+  record->wireSize = static_cast<uint32_t>(entry.getWireSize());
+  record->isLive = 1;
+  record->freshUntil = time::toUnixTimestamp(freshUntil).count();
+
+  m_records.emplace(m_tail, &entry);
+  m_offsets.emplace(&entry, m_tail);
+  setTail(m_tail + recordSize);
+}
+
+void
+PersistentStore::refresh(const Entry& entry, time::system_clock::TimePoint freshUntil)
+{
+  auto it = m_offsets.find(&entry);
+  if (it == m_offsets.end()) {
+    return;
+  }
+  getRecord(it->second)->freshUntil = time::toUnixTimestamp(freshUntil).count();
+}
+
+void
+PersistentStore::erase(const Entry& entry)
+{
+  auto it = m_offsets.find(&entry);
+  if (it == m_offsets.end()) {
+    return;
+  }
+
+  getRecord(it->second)->isLive = 0;
+  m_records.erase(it->second);
+  m_offsets.erase(it);
+
+  if (m_records.empty()) {
+    setTail(sizeof(FileHeader));
+  }
+}
+
+void
+PersistentStore::compact()
+{
+  std::map<size_t, const Entry*> records;
+  size_t out = sizeof(FileHeader);
+  for (const auto& record : m_records) {
+    size_t recordSize = getRecordSize(getRecord(record.first)->wireSize);
+    if (out != record.first) {
+      std::memmove(m_map + out, m_map + record.first, recordSize);
+    }
+    records.emplace_hint(records.end(), out, record.second);
+    if (record.second != nullptr) {
+      m_offsets[record.second] = out;
+    }
+    out += recordSize;
+  }
+
+  NFD_LOG_DEBUG("compact " << (m_tail - out) << " octets reclaimed");
+  m_records.swap(records);
+  setTail(out);
+}
+
+void
+PersistentStore::flush()
+{
+  if (::msync(m_map, m_size, MS_SYNC) < 0) {
+    NFD_LOG_WARN("Cannot flush " << m_path << ": " << std::strerror(errno));
+  }
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_PERSISTENT_STORE_HPP
+#define NFD_DAEMON_TABLE_CS_PERSISTENT_STORE_HPP
+
+#include "cs-entry.hpp"
+
+#include <map>
+#include <unordered_map>
+
+namespace nfd {
+namespace cs {
+
+/** \brief keeps the Data packets of the Content Store in a file, so that they survive a restart
+ *
+ *  The file is a log of records, each holding the wire encoding of a Data packet and the time
+ *  it becomes non-fresh. The file is memory-mapped: a new record is appended by copying the wire
+ *  encoding to the end of the log, and an erased record is only marked as dead. The record
+ *  headers form the on-disk index, which is scanned at startup without decoding dead records.
+ *  When the log is full, live records are compacted to the front of the file.
+ *
+ *  The store is attached to a Cs, which reports insertions and erasures of its entries.
+ */
+class PersistentStore : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /** \brief a record loaded from the file
+   */
+  struct Record
+  {
+    /// position of the record in the file
+    size_t offset;
+    /// wire encoding of the Data, in the mapped file
+    const uint8_t* wire;
+    /// size of the wire encoding
+    size_t wireSize;
+    /// time the Data becomes non-fresh
+    time::system_clock::TimePoint freshUntil;
+  };
+
+  /** \brief opens or creates the log file
+   *  \param path path of the file
+   *  \param maxSize size of the file in octets; an existing file is resized to this value,
+   *                 discarding the records that no longer fit
+   *  \throw Error the file cannot be opened or mapped
+   */
+  PersistentStore(const std::string& path, size_t maxSize);
+
+  ~PersistentStore();
+
+  const std::string&
+  getPath() const
+  {
+    return m_path;
+  }
+
+  /** \return size of the file in octets
+   */
+  size_t
+  getMaxSize() const
+  {
+    return m_size;
+  }
+
+  /** \return number of live records
+   */
+  size_t
+  size() const
+  {
+    return m_records.size();
+  }
+
+  /** \brief reads the live records in the file, in the order they were stored
+   *
+   *  Only the outer TLV of each record is checked; the Data packets are neither decoded nor
+   *  copied, and the returned records refer to the mapped file until the next insert().
+   *  Live records are compacted to the front of the file. Each returned record must then be
+   *  passed to either bind() or discard().
+   */
+  std::vector<Record>
+  load();
+
+  /** \brief associates a loaded record with the Content Store entry created from it
+   */
+  void
+  bind(const Record& record, const Entry& entry);
+
+  /** \brief marks a loaded record as dead
+   */
+  void
+  discard(const Record& record);
+
+  /** \brief appends a record for \p entry
+   *
+   *  If the log is full even after compaction, \p entry is not stored.
+   */
+  void
+  insert(const Entry& entry, time::system_clock::TimePoint freshUntil);
+
+  /** \brief updates the time the Data of \p entry becomes non-fresh
+   */
+  void
+  refresh(const Entry& entry, time::system_clock::TimePoint freshUntil);
+
+  /** \brief marks the record of \p entry as dead
+   */
+  void
+  erase(const Entry& entry);
+
+  /** \brief writes modified pages of the file to the disk
+   */
+  void
+  flush();
+
+private:
+  struct FileHeader;
+  struct RecordHeader;
+
+  /** \return size of a record holding a wire encoding of \p wireSize octets,
+   *          so that every record header is 8-octet aligned
+   */
+  static size_t
+  getRecordSize(size_t wireSize);
+
+  RecordHeader*
+  getRecord(size_t offset) const;
+
+  void
+  setTail(size_t tail);
+
+  /** \brief moves live records to the front of the log
+   */
+  void
+  compact();
+
+private:
+  std::string m_path;
+  size_t m_size;
+  int m_fd = -1;
+  uint8_t* m_map = nullptr;
+  size_t m_tail = 0;
+
+  std::map<size_t, const Entry*> m_records; ///< live records by offset, nullptr if not bound
+  std::unordered_map<const Entry*, size_t> m_offsets; ///< offsets of bound live records
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_PERSISTENT_STORE_HPP
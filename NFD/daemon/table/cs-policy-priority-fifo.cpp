@@ -77,7 +77,7 @@ PriorityFifoPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
 
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     this->evictOne();
   }
 }
@@ -118,7 +118,7 @@ PriorityFifoPolicy::attachQueue(EntryRef i)
   }
   else {
     entryInfo->queueType = QUEUE_FIFO;
-    entryInfo->moveStaleEventId = getScheduler().schedule(i->getData().getFreshnessPeriod(),
+    entryInfo->moveStaleEventId = getScheduler().schedule(i->getFreshnessPeriod(),
                                                           [=] { moveToStaleQueue(i); });
   }
 
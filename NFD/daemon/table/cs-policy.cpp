@@ -72,6 +72,20 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setLimitBytes(size_t nMaxBytes)
+{
+  NFD_LOG_INFO("setLimitBytes " << nMaxBytes);
+  m_limitBytes = nMaxBytes;
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  return m_cs->size() > m_limit || m_cs->getOccupiedBytes() > m_limitBytes;
+}
+
 void
 Policy::afterInsert(EntryRef i)
 {
@@ -104,6 +104,23 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets hard limit (in octets of memory held for wire encodings)
+   */
+  size_t
+  getLimitBytes() const
+  {
+    return m_limitBytes;
+  }
+
+  /** \brief sets hard limit (in octets of memory held for wire encodings)
+   *  \post getLimitBytes() == nMaxBytes
+   *  \post cs.getOccupiedBytes() <= getLimitBytes()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setLimitBytes(size_t nMaxBytes);
+
 public:
   /** \brief a reference to an CS entry
    *  \note operator< of EntryRef compares the Data name enclosed in the Entry.
@@ -119,6 +136,7 @@ public:
 
   /** \brief invoked by CS after a new entry is inserted
    *  \post cs.size() <= getLimit()
+   *  \post cs.getOccupiedBytes() <= getLimitBytes()
    *
    *  The policy may evict entries if necessary.
    *  During this process, \p i might be evicted.
@@ -184,11 +202,16 @@ protected:
   doBeforeUse(EntryRef i) = 0;
 
   /** \brief evicts zero or more entries
-   *  \post CS size does not exceed hard limit
+   *  \post CS size and occupied octets do not exceed hard limits
    */
   virtual void
   evictEntries() = 0;
 
+  /** \return whether CS size or occupied octets exceed hard limits
+   */
+  bool
+  isOverLimit() const;
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
@@ -202,6 +225,7 @@ private: // registry
 private:
   std::string m_policyName;
   size_t m_limit;
+  size_t m_limitBytes = std::numeric_limits<size_t>::max();
   Cs* m_cs;
 };
 
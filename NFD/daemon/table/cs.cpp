@@ -30,6 +30,8 @@
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/util/concepts.hpp>
 
+#include <cstring>
+
 namespace nfd {
 namespace cs {
 
@@ -47,6 +49,14 @@ Cs::Cs(size_t nMaxPackets)
   m_policy->setLimit(nMaxPackets);
 }
 
+Cs::~Cs()
+{
+  // slabs are released by the arena, but large blocks are individually allocated
+  for (const Entry& entry : m_table) {
+    m_arena.deallocate(const_cast<uint8_t*>(entry.getWire()), entry.getWireSize());
+  }
+}
+
 void
 Cs::insert(const Data& data, bool isUnsolicited)
 {
@@ -66,7 +76,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
 
   const_iterator it;
   bool isNewEntry = false;
-  std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited);
+  std::tie(it, isNewEntry) = emplaceEntry(Entry(data, isUnsolicited));
   Entry& entry = const_cast<Entry&>(*it);
 
   entry.updateFreshUntil();
@@ -77,13 +87,42 @@ Cs::insert(const Data& data, bool isUnsolicited)
       entry.clearUnsolicited();
     }
 
+    if (m_store != nullptr) {
+      m_store->refresh(entry, time::system_clock::now() + data.getFreshnessPeriod());
+    }
     m_policy->afterRefresh(it);
   }
   else {
+    if (m_store != nullptr) {
+      m_store->insert(entry, time::system_clock::now() + data.getFreshnessPeriod());
+    }
     m_policy->afterInsert(it);
   }
 }
 
+std::pair<Cs::const_iterator, bool>
+Cs::emplaceEntry(Entry&& entry)
+{
+  const_iterator it;
+  bool isNewEntry = false;
+  std::tie(it, isNewEntry) = m_table.insert(std::move(entry));
+  if (!isNewEntry) {
+    return {it, false};
+  }
+
+  // the entry still refers to the wire encoding it was created from
+  size_t wireSize = it->getWireSize();
+  uint8_t* wire = m_arena.allocate(wireSize);
+  std::memcpy(wire, it->getWire(), wireSize);
+  const_cast<Entry&>(*it).setWire(wire);
+
+  // the index points to the first of the entries with the same name
+  if ((it == m_table.begin() || std::prev(it)->getName() != it->getName())) {
+    m_nameIndex[it->getName()] = it;
+  }
+  return {it, true};
+}
+
 std::pair<Cs::const_iterator, Cs::const_iterator>
 Cs::findPrefixRange(const Name& prefix) const
 {
@@ -104,12 +143,53 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
   size_t nErased = 0;
   while (i != last && nErased < limit) {
     m_policy->beforeErase(i);
-    i = m_table.erase(i);
+    i = eraseEntry(i);
     ++nErased;
   }
   return nErased;
 }
 
+Cs::const_iterator
+Cs::eraseEntry(const_iterator it)
+{
+  auto indexIt = m_nameIndex.find(it->getName());
+  BOOST_ASSERT(indexIt != m_nameIndex.end());
+  if (indexIt->second == it) {
+    auto next = std::next(it);
+    if (next != m_table.end() && next->getName() == it->getName()) {
+      indexIt->second = next;
+    }
+    else {
+      m_nameIndex.erase(indexIt);
+    }
+  }
+
+  if (m_store != nullptr) {
+    m_store->erase(*it);
+  }
+  m_arena.deallocate(const_cast<uint8_t*>(it->getWire()), it->getWireSize());
+  return m_table.erase(it);
+}
+
+Cs::const_iterator
+Cs::findExactImpl(const Interest& interest) const
+{
+  const Name& name = interest.getName();
+  bool hasDigest = !name.empty() && name[-1].isImplicitSha256Digest();
+  auto indexIt = hasDigest ? m_nameIndex.find(name.getPrefix(-1)) : m_nameIndex.find(name);
+  if (indexIt == m_nameIndex.end()) {
+    return m_table.end();
+  }
+
+  const Name& dataName = indexIt->first;
+  for (auto it = indexIt->second; it != m_table.end() && it->getName() == dataName; ++it) {
+    if (it->canSatisfy(interest)) {
+      return it;
+    }
+  }
+  return m_table.end();
+}
+
 Cs::const_iterator
 Cs::findImpl(const Interest& interest) const
 {
@@ -117,6 +197,17 @@ Cs::findImpl(const Interest& interest) const
     return m_table.end();
   }
 
+  if (!interest.getCanBePrefix()) {
+    auto match = findExactImpl(interest);
+    if (match == m_table.end()) {
+      NFD_LOG_DEBUG("find " << interest.getName() << " no-match");
+      return m_table.end();
+    }
+    NFD_LOG_DEBUG("find " << interest.getName() << " matching " << match->getName());
+    m_policy->beforeUse(match);
+    return match;
+  }
+
   const Name& prefix = interest.getName();
   auto range = findPrefixRange(prefix);
   auto match = std::find_if(range.first, range.second,
@@ -146,8 +237,49 @@ Cs::setPolicy(unique_ptr<Policy> policy)
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t limitBytes = m_policy->getLimitBytes();
   this->setPolicyImpl(std::move(policy));
   m_policy->setLimit(limit);
+  m_policy->setLimitBytes(limitBytes);
+}
+
+void
+Cs::setPersistentStore(unique_ptr<PersistentStore> store)
+{
+  BOOST_ASSERT(store == nullptr || m_table.empty());
+  m_store = std::move(store);
+  if (m_store == nullptr) {
+    return;
+  }
+
+  auto steadyNow = time::steady_clock::now();
+  auto systemNow = time::system_clock::now();
+  size_t nLoaded = 0;
+  for (const auto& record : m_store->load()) {
+    optional<Entry> entry;
+    try {
+      entry.emplace(record.wire, record.wireSize, false);
+    }
+    catch (const tlv::Error& e) {
+      NFD_LOG_WARN("Discarding malformed record from " << m_store->getPath() << ": " << e.what());
+      m_store->discard(record);
+      continue;
+    }
+
+    const_iterator it;
+    bool isNewEntry = false;
+    std::tie(it, isNewEntry) = emplaceEntry(std::move(*entry));
+    if (!isNewEntry) { // duplicate record
+      m_store->discard(record);
+      continue;
+    }
+
+    m_store->bind(record, *it);
+    const_cast<Entry&>(*it).setFreshUntil(steadyNow + (record.freshUntil - systemNow));
+    m_policy->afterInsert(it);
+    ++nLoaded;
+  }
+  NFD_LOG_INFO("Loaded " << nLoaded << " entries from " << m_store->getPath());
 }
 
 void
@@ -155,7 +287,7 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { m_table.erase(it); });
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { eraseEntry(it); });
 
   m_policy->setCs(this);
   BOOST_ASSERT(m_policy->getCs() == this);
@@ -26,6 +26,8 @@
 #ifndef NFD_DAEMON_TABLE_CS_HPP
 #define NFD_DAEMON_TABLE_CS_HPP
 
+#include "cs-arena.hpp"
+#include "cs-persistent-store.hpp"
 #include "cs-policy.hpp"
 
 namespace nfd {
@@ -38,8 +40,14 @@ namespace cs {
  *  The Table is a container ( \c std::set ) sorted by full Names of stored Data packets.
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
+ *  A NameIndex hashes the Data names to their entries in the Table, so that lookups of
+ *  Interests without CanBePrefix do not depend on the size of the Table; the ordering of
+ *  the Table is only used for prefix lookups and erasure.
  *
  *  The replacement policy is implemented in a subclass of \c Policy.
+ *
+ *  If a PersistentStore is attached, every entry is also written to a file, from which the
+ *  Content Store is reloaded after a restart.
  */
 class Cs : noncopyable
 {
@@ -47,6 +55,8 @@ public:
   explicit
   Cs(size_t nMaxPackets = 10);
 
+  ~Cs();
+
   /** \brief inserts a Data packet
    */
   void
@@ -85,7 +95,8 @@ public:
       miss(interest);
       return;
     }
-    hit(interest, match->getData());
+    auto data = match->getData();
+    hit(interest, *data);
   }
 
   /** \brief get number of stored packets
@@ -96,6 +107,15 @@ public:
     return m_table.size();
   }
 
+  /** \brief get number of octets of memory held for the wire encodings of stored packets
+   *  \sa SlabArena::getOccupiedBytes
+   */
+  size_t
+  getOccupiedBytes() const
+  {
+    return m_arena.getOccupiedBytes();
+  }
+
 public: // configuration
   /** \brief get capacity (in number of packets)
    */
@@ -113,6 +133,22 @@ public: // configuration
     return m_policy->setLimit(nMaxPackets);
   }
 
+  /** \brief get capacity (in octets of memory held for wire encodings)
+   */
+  size_t
+  getLimitBytes() const
+  {
+    return m_policy->getLimitBytes();
+  }
+
+  /** \brief change capacity (in octets of memory held for wire encodings)
+   */
+  void
+  setLimitBytes(size_t nMaxBytes)
+  {
+    return m_policy->setLimitBytes(nMaxBytes);
+  }
+
   /** \brief get replacement policy
    */
   Policy*
@@ -127,6 +163,24 @@ public: // configuration
   void
   setPolicy(unique_ptr<Policy> policy);
 
+  /** \brief get persistent store, nullptr if none is attached
+   */
+  PersistentStore*
+  getPersistentStore() const
+  {
+    return m_store.get();
+  }
+
+  /** \brief attach a persistent store, and insert the Data packets loaded from it
+   *  \param store the store, or nullptr to detach the current store
+   *  \pre size() == 0 if \p store is not nullptr
+   *
+   *  Loaded entries are inserted in the order they were stored, and may be evicted by the
+   *  replacement policy. They keep the remaining freshness they had when they were stored.
+   */
+  void
+  setPersistentStore(unique_ptr<PersistentStore> store);
+
   /** \brief get CS_ENABLE_ADMIT flag
    *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
    */
@@ -173,12 +227,29 @@ public: // enumeration
   }
 
 private:
+  /** \brief inserts an entry into the Table and the NameIndex
+   *
+   *  If the entry is new, its wire encoding is copied into the arena.
+   *  \return iterator to the new or existing entry, and whether the entry is new
+   */
+  std::pair<const_iterator, bool>
+  emplaceEntry(Entry&& entry);
+
   std::pair<const_iterator, const_iterator>
   findPrefixRange(const Name& prefix) const;
 
   size_t
   eraseImpl(const Name& prefix, size_t limit);
 
+  /** \brief erases an entry from the Table and the NameIndex, and releases its wire encoding
+   *  \return iterator following the erased entry
+   */
+  const_iterator
+  eraseEntry(const_iterator it);
+
+  const_iterator
+  findExactImpl(const Interest& interest) const;
+
   const_iterator
   findImpl(const Interest& interest) const;
 
@@ -190,8 +261,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   dump();
 
 private:
+  SlabArena m_arena; ///< holds the wire encodings of entries; must outlive m_table
   Table m_table;
+  NameIndex m_nameIndex;
   unique_ptr<Policy> m_policy;
+  unique_ptr<PersistentStore> m_store;
   signal::ScopedConnection m_beforeEvictConnection;
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
@@ -238,7 +238,12 @@ private:
 
   name_tree::Entry* m_nameTreeEntry = nullptr;
 
+  /// slot in the PIT token table of the Pit, NO_TOKEN_SLOT if no token has been issued
+  uint32_t m_tokenSlot = NO_TOKEN_SLOT;
+  static constexpr uint32_t NO_TOKEN_SLOT = std::numeric_limits<uint32_t>::max();
+
   friend class name_tree::Entry;
+  friend class Pit;
 };
 
 } // namespace pit
@@ -98,9 +98,68 @@ Pit::findAllDataMatches(const Data& data) const
   return matches;
 }
 
+DataMatchResult
+Pit::findAllDataMatches(const Data& data, const Entry& entry) const
+{
+  const name_tree::Entry* nte = m_nameTree.getEntry(entry);
+  BOOST_ASSERT(nte != nullptr);
+  if (nte->hasChildren()) {
+    return this->findAllDataMatches(data);
+  }
+
+  DataMatchResult matches;
+  for (; nte != nullptr; nte = nte->getParent()) {
+    for (const auto& pitEntry : nte->getPitEntries()) {
+      if (pitEntry->getInterest().matchesData(data))
+        matches.emplace_back(pitEntry);
+    }
+  }
+  return matches;
+}
+
+uint64_t
+Pit::getToken(const shared_ptr<Entry>& entry)
+{
+  BOOST_ASSERT(entry != nullptr);
+
+  if (entry->m_tokenSlot == Entry::NO_TOKEN_SLOT) {
+    if (m_freeTokenSlots.empty()) {
+      entry->m_tokenSlot = static_cast<uint32_t>(m_tokenSlots.size());
+      m_tokenSlots.emplace_back();
+    }
+    else {
+      entry->m_tokenSlot = m_freeTokenSlots.back();
+      m_freeTokenSlots.pop_back();
+    }
+    m_tokenSlots[entry->m_tokenSlot].entry = entry;
+  }
+
+  const TokenSlot& slot = m_tokenSlots[entry->m_tokenSlot];
+  return (static_cast<uint64_t>(slot.generation) << 32) | entry->m_tokenSlot;
+}
+
+shared_ptr<Entry>
+Pit::findByToken(uint64_t token) const
+{
+  uint32_t index = static_cast<uint32_t>(token);
+  uint32_t generation = static_cast<uint32_t>(token >> 32);
+  if (index >= m_tokenSlots.size() || m_tokenSlots[index].generation != generation) {
+    return nullptr;
+  }
+  return m_tokenSlots[index].entry.lock();
+}
+
 void
 Pit::erase(Entry* entry, bool canDeleteNte)
 {
+  if (entry->m_tokenSlot != Entry::NO_TOKEN_SLOT) {
+    TokenSlot& slot = m_tokenSlots[entry->m_tokenSlot];
+    slot.entry.reset();
+    ++slot.generation;
+    m_freeTokenSlots.push_back(entry->m_tokenSlot);
+    entry->m_tokenSlot = Entry::NO_TOKEN_SLOT;
+  }
+
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
@@ -85,6 +85,37 @@ public:
   DataMatchResult
   findAllDataMatches(const Data& data) const;
 
+  /** \brief Performs a Data match starting from an entry known to match
+   *  \param data the Data packet
+   *  \param entry an entry whose Interest matches \p data, such as one found by a PIT token
+   *  \return an iterable of all PIT entries matching \p data, same as findAllDataMatches(data)
+   *
+   *  Other matching entries are either on the name tree path from \p entry to the root, or
+   *  below \p entry. If no name tree entry exists below \p entry, the matches are collected
+   *  by walking up from \p entry without a name tree lookup.
+   */
+  DataMatchResult
+  findAllDataMatches(const Data& data, const Entry& entry) const;
+
+  /** \brief Issues a PIT token for \p entry
+   *  \return a token that identifies \p entry until it is erased;
+   *          the same token is returned if one has already been issued for \p entry
+   *
+   *  The token consists of a slot index in its low 32 bits and the generation of the slot in its
+   *  high 32 bits. A slot is reused after its entry is erased, under a new generation, so that
+   *  a stale token does not resolve to an unrelated entry.
+   */
+  uint64_t
+  getToken(const shared_ptr<Entry>& entry);
+
+  /** \brief Finds the entry identified by a PIT token
+   *  \return the entry for which \p token was issued, or nullptr if it has been erased
+   *           or \p token was not issued by this table
+   *  \note The caller must still check that the entry matches the returned Data.
+   */
+  shared_ptr<Entry>
+  findByToken(uint64_t token) const;
+
   /** \brief Deletes an entry
    */
   void
@@ -136,6 +167,14 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+
+  struct TokenSlot
+  {
+    weak_ptr<Entry> entry;
+    uint32_t generation = 0;
+  };
+  std::vector<TokenSlot> m_tokenSlots;
+  std::vector<uint32_t> m_freeTokenSlots;
 };
 
 } // namespace pit
@@ -80,6 +80,42 @@ public:
     m_sendQueueLength = sendQueueLength;
   }
 
+  time::nanoseconds
+  getSendQueueDelay() override
+  {
+    return m_sendQueueDelay;
+  }
+
+  void
+  setSendQueueDelay(time::nanoseconds sendQueueDelay)
+  {
+    m_sendQueueDelay = sendQueueDelay;
+  }
+
+  time::nanoseconds
+  getSendQueueSojournTime() override
+  {
+    return m_sendQueueSojournTime;
+  }
+
+  void
+  setSendQueueSojournTime(time::nanoseconds sendQueueSojournTime)
+  {
+    m_sendQueueSojournTime = sendQueueSojournTime;
+  }
+
+  time::nanoseconds
+  getTimeOnAir(size_t packetSize) const override
+  {
+    return m_timeOnAirPerOctet * packetSize;
+  }
+
+  void
+  setTimeOnAirPerOctet(time::nanoseconds timeOnAirPerOctet)
+  {
+    m_timeOnAirPerOctet = timeOnAirPerOctet;
+  }
+
   void
   receivePacket(const Block& block)
   {
@@ -112,6 +148,9 @@ public:
 
 private:
   ssize_t m_sendQueueLength = 0;
+  time::nanoseconds m_sendQueueDelay = 0_ns;
+  time::nanoseconds m_sendQueueSojournTime = SOJOURN_TIME_UNSUPPORTED;
+  time::nanoseconds m_timeOnAirPerOctet = 0_ns;
 };
 
 using DummyTransport = DummyTransportBase<true>;
@@ -40,7 +40,7 @@ protected:
   makeChannel()
   {
     BOOST_ASSERT(netifs.size() > 0);
-    return make_unique<EthernetChannel>(netifs.front(), 2_s);
+    return make_unique<EthernetChannel>(netifs.front(), 2_s, false, false);
   }
 };
 
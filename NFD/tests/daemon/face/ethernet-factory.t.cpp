@@ -24,6 +24,7 @@
  */
 
 #include "face/ethernet-factory.hpp"
+#include "face/generic-link-service.hpp"
 
 #include "ethernet-fixture.hpp"
 #include "face-system-fixture.hpp"
@@ -123,6 +124,61 @@ BOOST_AUTO_TEST_CASE(DisableListen)
   BOOST_CHECK_EQUAL(this->countEtherMcastFaces(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Bundling)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        listen no
+        mcast no
+        bundling yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  shared_ptr<nfd::Face> face;
+  factory.createChannel(netifs.front(), 1_min)->connect(ethernet::Address::fromString("00:00:5e:00:53:5e"),
+                                                        {}, [&] (const auto& newFace) { face = newFace; },
+                                                        nullptr);
+  BOOST_REQUIRE(face != nullptr);
+  auto linkService = static_cast<GenericLinkService*>(face->getLinkService());
+  BOOST_CHECK_EQUAL(linkService->getOptions().allowBundling, true);
+}
+
+BOOST_AUTO_TEST_CASE(PitToken)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        listen no
+        mcast no
+        pit_token yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  shared_ptr<nfd::Face> face;
+  factory.createChannel(netifs.front(), 1_min)->connect(ethernet::Address::fromString("00:00:5e:00:53:5e"),
+                                                        {}, [&] (const auto& newFace) { face = newFace; },
+                                                        nullptr);
+  BOOST_REQUIRE(face != nullptr);
+  BOOST_CHECK_EQUAL(face->getLinkService()->allowsPitToken(), true);
+}
+
 BOOST_AUTO_TEST_CASE(McastNormal)
 {
   SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
@@ -334,6 +390,38 @@ BOOST_AUTO_TEST_CASE(BadListen)
   BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadBundling)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        bundling hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadPitToken)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        pit_token hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE_EXPECTED_FAILURES(BadIdleTimeout, 2) // Bug #4489
 BOOST_AUTO_TEST_CASE(BadIdleTimeout)
 {
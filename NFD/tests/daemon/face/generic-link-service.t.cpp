@@ -113,6 +113,8 @@ BOOST_AUTO_TEST_CASE(SendInterest)
   lp::Packet interest1pkt(transport->sentPackets.back().packet);
   BOOST_CHECK(interest1pkt.has<lp::FragmentField>());
   BOOST_CHECK(!interest1pkt.has<lp::SequenceField>());
+  // without header fields, the Interest is sent as is, without copying
+  BOOST_CHECK(transport->sentPackets.back().packet.wire() == interest1->wireEncode().wire());
 }
 
 BOOST_AUTO_TEST_CASE(SendData)
@@ -149,6 +151,11 @@ BOOST_AUTO_TEST_CASE(SendNack)
   BOOST_CHECK(nack1pkt.has<lp::NackField>());
   BOOST_CHECK(nack1pkt.has<lp::FragmentField>());
   BOOST_CHECK(!nack1pkt.has<lp::SequenceField>());
+
+  ndn::Buffer::const_iterator fragBegin, fragEnd;
+  std::tie(fragBegin, fragEnd) = nack1pkt.get<lp::FragmentField>();
+  const Block& interestWire = nack1.getInterest().wireEncode();
+  BOOST_CHECK_EQUAL_COLLECTIONS(fragBegin, fragEnd, interestWire.begin(), interestWire.end());
 }
 
 BOOST_AUTO_TEST_CASE(ReceiveBareInterest)
@@ -790,8 +797,177 @@ BOOST_AUTO_TEST_CASE(DefaultThreshold)
   BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 0);
 }
 
+BOOST_AUTO_TEST_CASE(SojournTime)
+{
+  GenericLinkService::Options options;
+  options.allowCongestionMarking = true;
+  options.baseCongestionMarkingInterval = 100_ms;
+  options.congestionSojournTarget = 5_ms;
+  initialize(options, MTU_UNLIMITED, 65536);
+  transport->setSendQueueSojournTime(0_ns);
+
+  auto interest = makeInterest("/12345678");
+
+  // queue length is ignored when the transport reports the sojourn time
+  transport->setSendQueueLength(65537);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::TimePoint::max());
+
+  // first packet above target, will not be marked
+  transport->setSendQueueSojournTime(6_ms);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  lp::Packet pkt2(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(pkt2.count<lp::CongestionMarkField>(), 0);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::now() + 100_ms);
+
+  // sojourn time stays above target for one interval
+  advanceClocks(101_ms);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 3);
+  lp::Packet pkt3(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(pkt3.count<lp::CongestionMarkField>(), 1);
+  BOOST_CHECK_EQUAL(service->m_nMarkedSinceInMarkingState, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 1);
+
+  // sojourn time drops to target, congestion incident ends
+  transport->setSendQueueSojournTime(5_ms);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 4);
+  lp::Packet pkt4(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(pkt4.count<lp::CongestionMarkField>(), 0);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::TimePoint::max());
+  BOOST_CHECK_EQUAL(service->m_nMarkedSinceInMarkingState, 0);
+}
+
+BOOST_AUTO_TEST_CASE(SojournTimeTargetFromTimeOnAir)
+{
+  GenericLinkService::Options options;
+  options.allowCongestionMarking = true;
+  options.baseCongestionMarkingInterval = 100_ms;
+  options.congestionSojournTarget = 5_ms;
+  initialize(options, 100, QUEUE_UNSUPPORTED);
+  // an MTU-sized packet takes 100 ms on the air, so TARGET is 100 ms and INTERVAL is 2 s
+  transport->setTimeOnAirPerOctet(1_ms);
+
+  auto interest = makeInterest("/12345678");
+
+  transport->setSendQueueSojournTime(50_ms);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::TimePoint::max());
+
+  transport->setSendQueueSojournTime(150_ms);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::now() + 2_s);
+
+  advanceClocks(1_s);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 3);
+  lp::Packet pkt3(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(pkt3.count<lp::CongestionMarkField>(), 0);
+
+  advanceClocks(1_s);
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 4);
+  lp::Packet pkt4(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(pkt4.count<lp::CongestionMarkField>(), 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // CongestionMark
 
+BOOST_AUTO_TEST_SUITE(Bundling)
+
+BOOST_AUTO_TEST_CASE(BundleWithinDelay)
+{
+  GenericLinkService::Options options;
+  options.allowBundling = true;
+  options.bundlingDelay = 10_ms;
+  initialize(options, 1500);
+
+  auto interest1 = makeInterest("/localhost/test1");
+  auto interest2 = makeInterest("/localhost/test2");
+  face->sendInterest(*interest1, 0);
+  face->sendInterest(*interest2, 0);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  const Block& frame = transport->sentPackets.back().packet;
+
+  bool isOk = false;
+  Block element1, element2;
+  std::tie(isOk, element1) = Block::fromBuffer(frame.wire(), frame.size());
+  BOOST_REQUIRE(isOk);
+  std::tie(isOk, element2) = Block::fromBuffer(frame.wire() + element1.size(),
+                                               frame.size() - element1.size());
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK_EQUAL(element1.size() + element2.size(), frame.size());
+
+  // LpPackets without header fields are encoded as bare network-layer packets
+  BOOST_CHECK(element1 == interest1->wireEncode());
+  BOOST_CHECK(element2 == interest2->wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(FlushWhenFull)
+{
+  auto interest = makeInterest("/localhost/test");
+  size_t lpPacketSize = lp::Packet(interest->wireEncode()).wireEncode().size();
+
+  GenericLinkService::Options options;
+  options.allowBundling = true;
+  options.bundlingDelay = 10_ms;
+  initialize(options, 2 * lpPacketSize + 1);
+
+  face->sendInterest(*interest, 0);
+  face->sendInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  // the third LpPacket does not fit in the MTU
+  face->sendInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(transport->sentPackets.back().packet.size(), 2 * lpPacketSize);
+
+  // a bundle of a single LpPacket is sent as is
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK(transport->sentPackets.back().packet == interest->wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(FlushOnEndpointChange)
+{
+  GenericLinkService::Options options;
+  options.allowBundling = true;
+  options.bundlingDelay = 10_ms;
+  initialize(options, 1500);
+
+  auto interest = makeInterest("/localhost/test");
+  face->sendInterest(*interest, 1);
+  face->sendInterest(*interest, 2);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(transport->sentPackets.back().endpoint, 1);
+
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(transport->sentPackets.back().endpoint, 2);
+}
+
+BOOST_AUTO_TEST_CASE(UnlimitedMtu)
+{
+  GenericLinkService::Options options;
+  options.allowBundling = true;
+  initialize(options, MTU_UNLIMITED);
+
+  auto interest = makeInterest("/localhost/test");
+  face->sendInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Bundling
+
 BOOST_AUTO_TEST_SUITE(LpFields)
 
 BOOST_AUTO_TEST_CASE(ReceiveNextHopFaceId)
@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/link-quality-estimator.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestLinkQualityEstimator)
+
+BOOST_AUTO_TEST_CASE(Unmeasured)
+{
+  LinkQualityEstimator estimator;
+  BOOST_CHECK_EQUAL(estimator.getEtx(), 1.0);
+  BOOST_CHECK(!estimator.getRssi());
+  BOOST_CHECK(!estimator.getSnr());
+  BOOST_CHECK_EQUAL(estimator.getAirtimePerDeliveredOctet(), 0_ns);
+}
+
+BOOST_AUTO_TEST_CASE(EtxFromReceptions)
+{
+  LinkQualityEstimator estimator;
+  estimator.addReceptions(1, 1);
+  // the link is assumed to be symmetric
+  BOOST_CHECK_CLOSE(estimator.getEtx(), 4.0, 0.001);
+
+  estimator.addReceptions(1, 0);
+  BOOST_CHECK_LT(estimator.getEtx(), 4.0);
+
+  // losses are limited by MIN_DELIVERY_RATIO
+  estimator.addReceptions(0, 1000);
+  BOOST_CHECK_CLOSE(estimator.getEtx(), 10000.0, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(EtxFromAcks)
+{
+  LinkQualityEstimator estimator;
+  estimator.addReceptions(1, 1);
+  estimator.addTransmissionOutcome(true);
+  // acknowledgements supersede the symmetry assumption
+  BOOST_CHECK_EQUAL(estimator.getEtx(), 1.0);
+
+  estimator.addTransmissionOutcome(false);
+  BOOST_CHECK_CLOSE(estimator.getEtx(), 1.0 / (1.0 - LinkQualityEstimator::ALPHA), 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(Signal)
+{
+  LinkQualityEstimator estimator;
+  estimator.addSignalSample(-100.0, 4.0);
+  BOOST_CHECK_EQUAL(*estimator.getRssi(), -100.0);
+  BOOST_CHECK_EQUAL(*estimator.getSnr(), 4.0);
+
+  estimator.addSignalSample(-60.0, 12.0);
+  BOOST_CHECK_CLOSE(*estimator.getRssi(), -95.0, 0.001);
+  BOOST_CHECK_CLOSE(*estimator.getSnr(), 5.0, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(AirtimePerDeliveredOctet)
+{
+  LinkQualityEstimator estimator;
+  estimator.addTransmission(100, 50_ms);
+  BOOST_CHECK_EQUAL(estimator.getAirtimePerDeliveredOctet(), 500_us);
+
+  // half of the frames are lost in each direction, so a frame is sent four times on average
+  estimator.addReceptions(1, 1);
+  BOOST_CHECK_EQUAL(estimator.getAirtimePerDeliveredOctet(), 2_ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLinkQualityEstimator
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
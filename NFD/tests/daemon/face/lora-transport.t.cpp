@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/lora-transport.hpp"
+#include "face/face.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "dummy-link-service.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/lp/packet.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+class LoRaTransportFixture : public GlobalIoTimeFixture
+{
+protected:
+  void
+  initialize(uint8_t dst)
+  {
+    face = make_unique<Face>(make_unique<DummyLinkService>(),
+                             make_unique<LoRaTransport>(std::make_pair(1, dst),
+                                                        FaceUri("lora://1"), FaceUri("lora://1-2"),
+                                                        &queue, &mutex, LoRaModulation()));
+    transport = face->getTransport();
+  }
+
+  /** \brief concatenates packets into one frame, as GenericLinkService does when bundling
+   */
+  static Block
+  makeBundle(std::initializer_list<Block> packets)
+  {
+    size_t size = 0;
+    for (const Block& packet : packets) {
+      size += packet.size();
+    }
+    ndn::EncodingBuffer buffer(size, size);
+    for (const Block& packet : packets) {
+      buffer.appendByteArray(packet.wire(), packet.size());
+    }
+    return buffer.block(false);
+  }
+
+protected:
+  LoRaSendQueue queue;
+  pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  unique_ptr<Face> face;
+  Transport* transport = nullptr;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestLoRaTransport, LoRaTransportFixture)
+
+BOOST_AUTO_TEST_CASE(OverhearingKey)
+{
+  Block data = makeData("/A")->wireEncode();
+  Block data2 = makeData("/B")->wireEncode();
+
+  lp::Packet lpPacket(data);
+  lpPacket.add<lp::SequenceField>(1);
+  BOOST_CHECK_NE(computeOverhearingKey(data), 0);
+  BOOST_CHECK_EQUAL(computeOverhearingKey(lpPacket.wireEncode()), computeOverhearingKey(data));
+  BOOST_CHECK_NE(computeOverhearingKey(data2), computeOverhearingKey(data));
+
+  // Interests are deferred and cancelled by the forwarding strategy instead
+  BOOST_CHECK_EQUAL(computeOverhearingKey(makeInterest("/A", false, nullopt, 1)->wireEncode()), 0);
+
+  lp::Packet ackOnly;
+  ackOnly.add<lp::AckField>(1);
+  BOOST_CHECK_EQUAL(computeOverhearingKey(ackOnly.wireEncode()), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelOverheard)
+{
+  Block data = makeData("/A")->wireEncode();
+  Block data2 = makeData("/B")->wireEncode();
+  lp::Packet ackOnly;
+  ackOnly.add<lp::AckField>(1);
+
+  queue.push_back({1, 0, {}});
+  queue.push_back({1, 0, {}, nullptr, {}, computeOverhearingKey(data)});
+  queue.push_back({1, 0, {}, nullptr, {}, computeOverhearingKey(data2)});
+  queue.push_back({1, 0, {}, nullptr, {}, computeOverhearingKey(data)});
+
+  // packets without a key never cancel anything, not even frames without a key
+  BOOST_CHECK_EQUAL(cancelOverheardFrames(queue, ackOnly.wireEncode()), 0);
+  BOOST_CHECK_EQUAL(cancelOverheardFrames(queue, makeInterest("/C")->wireEncode()), 0);
+  BOOST_CHECK_EQUAL(queue.size(), 4);
+
+  // only the frames carrying the overheard packet are removed
+  BOOST_CHECK_EQUAL(cancelOverheardFrames(queue, data), 2);
+  BOOST_REQUIRE_EQUAL(queue.size(), 2);
+  BOOST_CHECK_EQUAL(queue[0].overhearingKey, 0);
+  BOOST_CHECK_EQUAL(queue[1].overhearingKey, computeOverhearingKey(data2));
+}
+
+BOOST_AUTO_TEST_CASE(FindReadyFrame)
+{
+  auto now = time::steady_clock::now();
+  BOOST_CHECK(findReadyFrame(queue, now) == queue.end());
+
+  queue.push_back({1, 0, {}, nullptr, now + 10_ms, 1});
+  queue.push_back({1, 0, {}, nullptr, now - 1_ms, 2});
+  queue.push_back({1, 0, {}, nullptr, now, 3});
+
+  // a deferred frame does not hold back the ready frames behind it, which are sent in order
+  auto it = findReadyFrame(queue, now);
+  BOOST_REQUIRE(it != queue.end());
+  BOOST_CHECK_EQUAL(it->overhearingKey, 2);
+  queue.erase(it);
+  it = findReadyFrame(queue, now);
+  BOOST_REQUIRE(it != queue.end());
+  BOOST_CHECK_EQUAL(it->overhearingKey, 3);
+  queue.erase(it);
+  BOOST_CHECK(findReadyFrame(queue, now) == queue.end());
+
+  // the deferred frame becomes ready when its deferral elapses
+  it = findReadyFrame(queue, now + 10_ms);
+  BOOST_REQUIRE(it != queue.end());
+  BOOST_CHECK_EQUAL(it->overhearingKey, 1);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastBundle)
+{
+  initialize(0); // broadcast
+
+  Block interestWire = makeInterest("/A", false, nullopt, 1)->wireEncode();
+  Block bareDataWire = makeData("/A")->wireEncode();
+  lp::Packet dataPacket(makeData("/B")->wireEncode());
+  dataPacket.add<lp::SequenceField>(2);
+  lp::Packet ackOnly;
+  ackOnly.add<lp::AckField>(1);
+  lp::Packet ackOnly2;
+  ackOnly2.add<lp::AckField>(3);
+
+  Block dataWire = dataPacket.wireEncode();
+  Block ackWire = ackOnly.wireEncode();
+  Block ackWire2 = ackOnly2.wireEncode();
+  auto before = time::steady_clock::now();
+  transport->send(makeBundle({bareDataWire, ackWire, interestWire, dataWire, ackWire2}));
+
+  // packets without an overhearing key, including Interests, stay bundled and are not deferred
+  BOOST_REQUIRE_EQUAL(queue.size(), 3);
+  BOOST_CHECK_EQUAL(queue[0].overhearingKey, 0);
+  BOOST_CHECK(queue[0].notBefore >= before);
+  BOOST_CHECK(queue[0].notBefore <= time::steady_clock::now());
+  Block bundled = makeBundle({ackWire, interestWire, ackWire2});
+  BOOST_CHECK_EQUAL_COLLECTIONS(queue[0].payload.begin(), queue[0].payload.end(),
+                                bundled.begin(), bundled.end());
+
+  // each cancellable packet is deferred in a frame of its own
+  BOOST_CHECK_EQUAL(queue[1].overhearingKey, computeOverhearingKey(bareDataWire));
+  BOOST_CHECK_EQUAL_COLLECTIONS(queue[1].payload.begin(), queue[1].payload.end(),
+                                bareDataWire.begin(), bareDataWire.end());
+  BOOST_CHECK_EQUAL(queue[2].overhearingKey, computeOverhearingKey(dataWire));
+  BOOST_CHECK_EQUAL_COLLECTIONS(queue[2].payload.begin(), queue[2].payload.end(),
+                                dataWire.begin(), dataWire.end());
+  for (const auto& frame : queue) {
+    BOOST_CHECK(frame.sender == transport);
+    BOOST_CHECK_EQUAL(frame.src, 1);
+    BOOST_CHECK_EQUAL(frame.dst, 0);
+  }
+
+  // overhearing one Data cancels only its own frame
+  BOOST_CHECK_EQUAL(cancelOverheardFrames(queue, makeData("/A")->wireEncode()), 1);
+  BOOST_REQUIRE_EQUAL(queue.size(), 2);
+  BOOST_CHECK_EQUAL(queue[0].overhearingKey, 0);
+  BOOST_CHECK_EQUAL(queue[1].overhearingKey, computeOverhearingKey(dataWire));
+}
+
+BOOST_AUTO_TEST_CASE(SendQueuePerFace)
+{
+  initialize(2);
+  unique_ptr<Transport> other = make_unique<LoRaTransport>(std::make_pair(1, 3),
+                                                           FaceUri("lora://1"), FaceUri("lora://1-3"),
+                                                           &queue, &mutex, LoRaModulation());
+
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), 0);
+  BOOST_CHECK_EQUAL(transport->getSendQueueSojournTime(), 0_ns);
+
+  // frames of another face on the same radio are not counted
+  other->send(makeInterest("/A")->wireEncode());
+  advanceClocks(50_ms);
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), 0);
+  BOOST_CHECK_EQUAL(transport->getSendQueueSojournTime(), 0_ns);
+  BOOST_CHECK_EQUAL(other->getSendQueueSojournTime(), 50_ms);
+
+  Block interest = makeInterest("/B")->wireEncode();
+  transport->send(interest);
+  advanceClocks(20_ms);
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), static_cast<ssize_t>(interest.size()));
+  BOOST_CHECK_EQUAL(transport->getSendQueueSojournTime(), 20_ms);
+}
+
+BOOST_AUTO_TEST_CASE(UnicastBundle)
+{
+  initialize(2);
+
+  Block interest = makeInterest("/A", false, nullopt, 1)->wireEncode();
+  Block data = makeData("/B")->wireEncode();
+  Block bundle = makeBundle({interest, data});
+  transport->send(bundle);
+
+  // unicast frames are never deferred or cancelled
+  BOOST_REQUIRE_EQUAL(queue.size(), 1);
+  BOOST_CHECK_EQUAL(queue[0].overhearingKey, 0);
+  BOOST_CHECK_EQUAL_COLLECTIONS(queue[0].payload.begin(), queue[0].payload.end(),
+                                bundle.begin(), bundle.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLoRaTransport
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
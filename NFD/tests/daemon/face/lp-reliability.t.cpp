@@ -710,6 +710,103 @@ BOOST_AUTO_TEST_CASE(CancelLossNotificationOnAck)
   BOOST_CHECK_EQUAL(linkService->getCounters().nDroppedInterests, 0);
 }
 
+BOOST_AUTO_TEST_CASE(SpuriousRetx)
+{
+  linkService->sendLpPackets({makeFrag(1, 50)});
+  lp::Sequence firstTxSeq = reliability->m_firstUnackedFrag->first;
+
+  // T+1250ms: RTO expired, fragment retransmitted with a new TxSequence
+  advanceClocks(1_ms, 1250);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq), 0);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 1), 1);
+  BOOST_CHECK_EQUAL(reliability->m_supersededTxs.count(firstTxSeq), 1);
+  BOOST_CHECK(!reliability->m_rttEst.hasSamples());
+
+  // Ack for the original transmission arrives
+  lp::Packet ackPkt;
+  ackPkt.add<lp::AckField>(firstTxSeq);
+  reliability->processIncomingPacket(ackPkt);
+
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 0);
+  BOOST_CHECK_EQUAL(reliability->m_supersededTxs.size(), 0);
+  BOOST_CHECK(reliability->m_rttEst.hasSamples());
+  BOOST_CHECK_EQUAL(linkService->getCounters().nSpuriousRetx, 1);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 1);
+
+  // Ack for the retransmission is ignored
+  lp::Packet ackPkt2;
+  ackPkt2.add<lp::AckField>(firstTxSeq + 1);
+  reliability->processIncomingPacket(ackPkt2);
+
+  BOOST_CHECK_EQUAL(linkService->getCounters().nSpuriousRetx, 1);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 1);
+
+  advanceClocks(1_ms, 5000);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 0);
+}
+
+BOOST_AUTO_TEST_CASE(RtoBoundedByTimeOnAir)
+{
+  // LpPacket of 66 octets: 660ms time-on-air; IDLE packet with Ack: 140ms time-on-air
+  transport->setTimeOnAirPerOctet(10_ms);
+  transport->setSendQueueDelay(200_ms);
+
+  linkService->sendLpPackets({makeFrag(1, 50)});
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.back().packet.size(), 66);
+  lp::Sequence firstTxSeq = reliability->m_firstUnackedFrag->first;
+
+  // no RTT sample yet: RTO is seeded with 2 * (200ms + 660ms + 5ms + 140ms) = 2010ms,
+  // instead of the default initial RTO of 1s
+  advanceClocks(10_ms, 195);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+
+  // after an RTT sample of 100ms, RTO is bounded by 200ms + 660ms + 5ms + 140ms = 1005ms,
+  // instead of 300ms computed by the RTT estimator
+  reliability->m_rttEst.addMeasurement(100_ms);
+  BOOST_REQUIRE(reliability->m_rttEst.getEstimatedRto() < 1005_ms);
+  linkService->sendLpPackets({makeFrag(2, 50)});
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  advanceClocks(10_ms, 95);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 4);
+
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq), 0);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 0);
+}
+
+BOOST_AUTO_TEST_CASE(RetxAirtimeBudget)
+{
+  auto opts = linkService->getOptions();
+  opts.reliabilityOptions.maxRetx = 5;
+  opts.reliabilityOptions.maxRetxAirtime = 1500_ms;
+  linkService->setOptions(opts);
+  transport->setTimeOnAirPerOctet(10_ms); // 660ms per transmission
+
+  linkService->sendLpPackets({makeFrag(1, 50)});
+
+  // two retransmissions fit into the budget, the third one would exceed it
+  advanceClocks(100_ms, 100);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 0);
+  BOOST_CHECK_EQUAL(reliability->m_supersededTxs.size(), 0);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 1);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nDroppedInterests, 1);
+
+  // without time-on-air, maxRetx applies
+  transport->setTimeOnAirPerOctet(0_ns);
+  linkService->sendLpPackets({makeFrag(2, 50)});
+  advanceClocks(100_ms, 100);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 9);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 2);
+}
+
 BOOST_AUTO_TEST_CASE(ProcessIncomingPacket)
 {
   BOOST_CHECK(!reliability->m_idleAckTimer);
@@ -220,6 +220,35 @@ BOOST_AUTO_TEST_CASE(ConfigureNonLocal)
   limitedIo.run(1, 100_ms);
 }
 
+BOOST_AUTO_TEST_CASE(PitToken)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      tcp
+      {
+        port 7001
+        enable_v6 no
+        pit_token yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  shared_ptr<nfd::Face> face;
+  createChannel("127.0.0.1", "7002")->connect(tcp::Endpoint(boost::asio::ip::address_v4::loopback(), 7001), {},
+    [&] (const auto& newFace) {
+      face = newFace;
+      limitedIo.afterOp();
+    },
+    [&] (auto...) { limitedIo.afterOp(); });
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE(face != nullptr);
+  BOOST_CHECK_EQUAL(face->getLinkService()->allowsPitToken(), true);
+}
+
 BOOST_AUTO_TEST_CASE(Omitted)
 {
   const std::string CONFIG = R"CONFIG(
@@ -267,6 +296,22 @@ BOOST_AUTO_TEST_CASE(BadListen)
   BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadPitToken)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      tcp
+      {
+        pit_token hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE_EXPECTED_FAILURES(BadPort, 2) // Bug #4489
 BOOST_AUTO_TEST_CASE(BadPort)
 {
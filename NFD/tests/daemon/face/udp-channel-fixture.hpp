@@ -44,7 +44,7 @@ protected:
     if (port == 0)
       port = getNextPort();
 
-    return make_unique<UdpChannel>(udp::Endpoint(addr, port), 2_s, false);
+    return make_unique<UdpChannel>(udp::Endpoint(addr, port), 2_s, false, false, false);
   }
 
   void
@@ -24,6 +24,7 @@
  */
 
 #include "face/udp-factory.hpp"
+#include "face/generic-link-service.hpp"
 
 #include "face-system-fixture.hpp"
 #include "factory-test-common.hpp"
@@ -265,6 +266,57 @@ BOOST_AUTO_TEST_CASE(DisableV6)
   checkChannelListEqual(factory, {"udp4://0.0.0.0:7001"});
 }
 
+BOOST_AUTO_TEST_CASE(Bundling)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        port 7001
+        enable_v6 no
+        mcast no
+        bundling yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  shared_ptr<Face> face;
+  createChannel("0.0.0.0", 7001)->connect(udp::Endpoint(boost::asio::ip::address_v4::loopback(), 7002),
+                                          {}, [&] (const auto& newFace) { face = newFace; }, nullptr);
+  BOOST_REQUIRE(face != nullptr);
+  auto linkService = static_cast<GenericLinkService*>(face->getLinkService());
+  BOOST_CHECK_EQUAL(linkService->getOptions().allowBundling, true);
+}
+
+BOOST_AUTO_TEST_CASE(PitToken)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        port 7001
+        enable_v6 no
+        mcast no
+        pit_token yes
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  shared_ptr<Face> face;
+  createChannel("0.0.0.0", 7001)->connect(udp::Endpoint(boost::asio::ip::address_v4::loopback(), 7002),
+                                          {}, [&] (const auto& newFace) { face = newFace; }, nullptr);
+  BOOST_REQUIRE(face != nullptr);
+  BOOST_CHECK_EQUAL(face->getLinkService()->allowsPitToken(), true);
+}
+
 BOOST_FIXTURE_TEST_CASE(EnableDisableMcast, UdpFactoryMcastFixture)
 {
   const std::string CONFIG_WITH_MCAST = R"CONFIG(
@@ -579,6 +631,38 @@ BOOST_AUTO_TEST_CASE(BadListen)
   BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadBundling)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        bundling hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadPitToken)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        pit_token hello
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE_EXPECTED_FAILURES(BadPort, 2) // Bug #4489
 BOOST_AUTO_TEST_CASE(BadPort)
 {
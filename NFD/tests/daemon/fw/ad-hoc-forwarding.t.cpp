@@ -29,6 +29,7 @@
 
 // Strategies that can forward Interest to an ad hoc face even if it's the downstream,
 // sorted alphabetically.
+#include "fw/ad-hoc-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
@@ -87,6 +88,7 @@ BOOST_AUTO_TEST_SUITE(Fw)
 BOOST_AUTO_TEST_SUITE(TestAdHocForwarding)
 
 using Strategies = boost::mpl::vector<
+  AdHocStrategy,
   AsfStrategy,
   BestRouteStrategy2,
   MulticastStrategy,
@@ -0,0 +1,234 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/ad-hoc-strategy.hpp"
+#include "common/global.hpp"
+#include "face/generic-link-service.hpp"
+#include "face/lora-transport.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using AdHocStrategyTester = StrategyTester<AdHocStrategy>;
+NFD_REGISTER_STRATEGY(AdHocStrategyTester);
+
+class AdHocStrategyFixture : public GlobalIoTimeFixture
+{
+protected:
+  AdHocStrategyFixture()
+    : face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>("dummy://", "dummy://", ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                   ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                   ndn::nfd::LINK_TYPE_AD_HOC))
+  {
+    faceTable.add(face1);
+    faceTable.add(face2);
+
+    fib::Entry& fibEntry = *fib.insert("/P").first;
+    fib.addOrUpdateNextHop(fibEntry, *face1, 0);
+    fib.addOrUpdateNextHop(fibEntry, *face2, 0);
+  }
+
+  /** \brief receives an Interest on \p inFace and passes it to the strategy
+   */
+  shared_ptr<pit::Entry>
+  receiveInterest(Face& inFace, const Interest& interest)
+  {
+    shared_ptr<pit::Entry> pitEntry = pit.insert(interest).first;
+    pitEntry->insertOrUpdateInRecord(inFace, interest);
+    strategy.afterReceiveInterest(FaceEndpoint(inFace, 0), interest, pitEntry);
+    return pitEntry;
+  }
+
+  size_t
+  countSentTo(const Face& face) const
+  {
+    return std::count_if(strategy.sendInterestHistory.begin(), strategy.sendInterestHistory.end(),
+                         [&face] (const AdHocStrategyTester::SendInterestArgs& args) {
+                           return args.outFaceId == face.getId();
+                         });
+  }
+
+protected:
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  AdHocStrategyTester& strategy{choose<AdHocStrategyTester>(forwarder)};
+  Fib& fib{forwarder.getFib()};
+  Pit& pit{forwarder.getPit()};
+
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+  shared_ptr<DummyFace> face3 = make_shared<DummyFace>();
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestAdHocStrategy, AdHocStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(DeferOnAdHocFace)
+{
+  faceTable.add(face3);
+  auto interest = makeInterest("/P/1");
+  receiveInterest(*face3, *interest);
+
+  // point-to-point face is used immediately, ad hoc face after the deferral
+  BOOST_CHECK_EQUAL(countSentTo(*face1), 1);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 0);
+
+  auto window = AdHocStrategy::getDeferralWindow(*face2, *interest);
+  BOOST_CHECK_EQUAL(window, AdHocStrategy::MIN_DEFERRAL_WINDOW);
+  this->advanceClocks(1_ms, window);
+  BOOST_CHECK_EQUAL(countSentTo(*face1), 1);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 1);
+  BOOST_CHECK_EQUAL(strategy.rejectPendingInterestHistory.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelWhenOverheard)
+{
+  faceTable.add(face3);
+  auto interest = makeInterest("/P/1");
+  auto pitEntry = receiveInterest(*face3, *interest);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 0);
+
+  // a neighbor relays the same Interest on the ad hoc face before the deferral expires
+  strategy.afterReceiveLoopedInterest(FaceEndpoint(*face2, 0), *interest, pitEntry);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW * 2);
+  BOOST_CHECK_EQUAL(countSentTo(*face1), 1);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(AdHocDownstream)
+{
+  // Interest received on the ad hoc face can be relayed on the same face
+  auto interest = makeInterest("/P/1");
+  auto pitEntry = receiveInterest(*face2, *interest);
+  BOOST_CHECK_EQUAL(countSentTo(*face1), 1);
+
+  // the deferred transmission is not repeated when the downstream retransmits meanwhile
+  this->advanceClocks(1_ms);
+  pitEntry->insertOrUpdateInRecord(*face2, *interest);
+  strategy.afterReceiveInterest(FaceEndpoint(*face2, 0), *interest, pitEntry);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 1);
+}
+
+BOOST_AUTO_TEST_CASE(NoSendAfterSatisfied)
+{
+  faceTable.add(face3);
+  auto interest = makeInterest("/P/1");
+  auto pitEntry = receiveInterest(*face3, *interest);
+
+  pitEntry->isSatisfied = true;
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DataPathPriority)
+{
+  faceTable.add(face3);
+  auto data = makeData("/P/1");
+
+  // Data fetched through the ad hoc face puts this node on the Data path
+  auto interest1 = makeInterest("/P/1");
+  auto pitEntry1 = receiveInterest(*face3, *interest1);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW);
+  BOOST_REQUIRE_EQUAL(countSentTo(*face2), 1);
+  strategy.afterReceiveData(pitEntry1, FaceEndpoint(*face2, 0), *data);
+
+  // so the next Interest is deferred by less than half the window
+  auto interest2 = makeInterest("/P/2");
+  receiveInterest(*face3, *interest2);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW / 2);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 2);
+
+  // Data overheard on the ad hoc face, without an out-record, takes this node off the Data path
+  auto interest3 = makeInterest("/P/3");
+  auto pitEntry3 = pit.insert(*interest3).first;
+  pitEntry3->insertOrUpdateInRecord(*face3, *interest3);
+  strategy.afterReceiveData(pitEntry3, FaceEndpoint(*face2, 0), *makeData("/P/3"));
+
+  auto interest4 = makeInterest("/P/4");
+  receiveInterest(*face3, *interest4);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW / 2 - 1_ms);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 2);
+  this->advanceClocks(1_ms, AdHocStrategy::MIN_DEFERRAL_WINDOW / 2 + 1_ms);
+  BOOST_CHECK_EQUAL(countSentTo(*face2), 3);
+}
+
+BOOST_AUTO_TEST_CASE(DataPathOnLoRaFace)
+{
+  FaceTable loraFaceTable;
+  Forwarder loraForwarder{loraFaceTable};
+  choose<AdHocStrategy>(loraForwarder);
+
+  face::LoRaSendQueue queue;
+  pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  auto consumer = make_shared<DummyFace>();
+  auto loraFace = make_shared<Face>(make_unique<face::GenericLinkService>(),
+                                    make_unique<face::LoRaTransport>(std::make_pair(1, 0), // broadcast
+                                                                     FaceUri("lora://1"),
+                                                                     FaceUri("lora://1"),
+                                                                     &queue, &mutex,
+                                                                     face::LoRaModulation()));
+  loraFaceTable.add(consumer);
+  loraFaceTable.add(loraFace);
+  fib::Entry& fibEntry = *loraForwarder.getFib().insert("/P").first;
+  loraForwarder.getFib().addOrUpdateNextHop(fibEntry, *loraFace, 0);
+
+  // a node off the Data path defers the Interest into the second half of the window
+  auto interest1 = makeInterest("/P/1");
+  auto window = AdHocStrategy::getDeferralWindow(*loraFace, *interest1);
+  consumer->receiveInterest(*interest1, 0);
+  this->advanceClocks(1_ms, window / 2 - 1_ms);
+  BOOST_CHECK(queue.empty());
+  this->advanceClocks(1_ms, window / 2 + 1_ms);
+  BOOST_REQUIRE_EQUAL(queue.size(), 1);
+
+  // the transport does not defer the Interest again
+  BOOST_CHECK_EQUAL(queue[0].overhearingKey, 0);
+  BOOST_CHECK(queue[0].notBefore <= time::steady_clock::now());
+  queue.clear();
+
+  // Data fetched through the LoRa face puts this node on the Data path
+  static_cast<face::LoRaTransport*>(loraFace->getTransport())->receiveData(makeData("/P/1")->wireEncode());
+  BOOST_REQUIRE_EQUAL(consumer->sentData.size(), 1);
+
+  // so the next Interest is transmitted within the first half of the window
+  consumer->receiveInterest(*makeInterest("/P/2"), 0);
+  this->advanceClocks(1_ms, window / 2 + 1_ms);
+  BOOST_CHECK_EQUAL(queue.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAdHocStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
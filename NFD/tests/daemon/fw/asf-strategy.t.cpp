@@ -25,6 +25,10 @@
 
 #include "fw/asf-strategy.hpp"
 
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
+#include "choose-strategy.hpp"
 #include "strategy-tester.hpp"
 #include "topology-tester.hpp"
 
@@ -181,6 +185,25 @@ BOOST_FIXTURE_TEST_CASE(Basic, AsfGridFixture)
   BOOST_CHECK_GE(linkAD->getFace(nodeA).getCounters().nOutInterests, 59); // FIXME #3830
 }
 
+BOOST_FIXTURE_TEST_CASE(LossyLink, AsfStrategyParametersGridFixture)
+{
+  topo.registerPrefix(nodeB, linkBC->getFace(nodeB), PRODUCER_PREFIX);
+  topo.registerPrefix(nodeD, linkCD->getFace(nodeD), PRODUCER_PREFIX);
+
+  // Most transmissions on the link from nodeA to nodeB are lost
+  for (int i = 0; i < 30; ++i) {
+    linkAB->getFace(nodeA).getTransport()->getLinkQuality().addTransmissionOutcome(false);
+  }
+
+  runConsumer();
+
+  // ASF should keep using the Face to nodeD, because the Face to nodeB needs many
+  // transmissions per Interest although its RTT is lower
+  BOOST_CHECK_EQUAL(consumer->getForwarderFace().getCounters().nOutData, 30);
+  BOOST_CHECK_LE(linkAB->getFace(nodeA).getCounters().nOutInterests, 6);
+  BOOST_CHECK_GE(linkAD->getFace(nodeA).getCounters().nOutInterests, 24);
+}
+
 BOOST_FIXTURE_TEST_CASE(Nack, AsfGridFixture)
 {
   // nodeB has a FIB entry to reach the producer, but nodeD does not
@@ -453,6 +476,60 @@ BOOST_FIXTURE_TEST_CASE(ProbingInterval, AsfStrategyParametersGridFixture)
   BOOST_CHECK_EQUAL(linkAC->getFace(nodeA).getCounters().nOutInterests, 1);
 }
 
+BOOST_AUTO_TEST_CASE(ProbingAirtimeBudget)
+{
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto radioFace = make_shared<DummyFace>();
+  faceTable.add(face1);
+  faceTable.add(face2);
+  faceTable.add(radioFace);
+  auto radioTransport = static_cast<face::tests::DummyTransport*>(radioFace->getTransport());
+  radioTransport->setTimeOnAirPerOctet(30_ms);
+
+  auto& strategy = choose<AsfStrategyTester>(forwarder, "/",
+                     Name(AsfStrategyTester::getStrategyName())
+                     .append("probing-interval~1000")
+                     .append("n-silent-timeouts~1000"));
+  fib::Entry& fibEntry = *forwarder.getFib().insert("/P").first;
+  forwarder.getFib().addOrUpdateNextHop(fibEntry, *face2, 1);
+  forwarder.getFib().addOrUpdateNextHop(fibEntry, *radioFace, 2);
+
+  int seq = 0;
+  auto runConsumer = [&] (time::nanoseconds duration) {
+    for (auto end = time::steady_clock::now() + duration; time::steady_clock::now() < end;) {
+      auto interest = makeInterest(Name("/P").appendNumber(++seq));
+      auto pitEntry = forwarder.getPit().insert(*interest).first;
+      pitEntry->insertOrUpdateInRecord(*face1, *interest);
+      strategy.afterReceiveInterest(FaceEndpoint(*face1, 0), *interest, pitEntry);
+      this->advanceClocks(100_ms);
+    }
+  };
+  auto countProbes = [&] {
+    return std::count_if(strategy.sendInterestHistory.begin(), strategy.sendInterestHistory.end(),
+                         [&] (const auto& args) { return args.outFaceId == radioFace->getId(); });
+  };
+
+  // A probe takes about 500ms of airtime, so the radio face is probed once
+  // although probing is due every second
+  runConsumer(20_s);
+  BOOST_CHECK_EQUAL(countProbes(), 1);
+
+  // No probe is sent while frames of the face are waiting for the medium, even after the airtime
+  // is replenished
+  radioTransport->setSendQueueLength(100);
+  radioTransport->setSendQueueDelay(100_ms);
+  runConsumer(60_s);
+  BOOST_CHECK_EQUAL(countProbes(), 1);
+
+  // Frames of other faces sharing the medium delay the face, but do not stop its probes
+  radioTransport->setSendQueueLength(0);
+  runConsumer(2_s);
+  BOOST_CHECK_EQUAL(countProbes(), 2);
+}
+
 class ParametersFixture
 {
 public:
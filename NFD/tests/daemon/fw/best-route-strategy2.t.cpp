@@ -141,6 +141,26 @@ BOOST_AUTO_TEST_CASE(Forward)
   // face1 cannot be used because it's gone from FIB entry
 }
 
+BOOST_AUTO_TEST_CASE(PreferLowerEtxAmongEqualCost)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face1, 10);
+  fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+  fib.addOrUpdateNextHop(fibEntry, *face3, 20);
+
+  // face1 loses half of the frames, face3 is lossless but has a higher cost
+  face1->getTransport()->getLinkQuality().addReceptions(1, 1);
+  face3->getTransport()->getLinkQuality().addReceptions(1, 0);
+
+  shared_ptr<Interest> interest = makeInterest("/NNBN3kEK");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face4, *interest);
+  strategy.afterReceiveInterest(FaceEndpoint(*face4, 0), *interest, pitEntry);
+
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, face2->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestBestRouteStrategy2
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -45,6 +45,7 @@ DummyStrategy::getStrategyName(uint64_t version)
 DummyStrategy::DummyStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder)
   , afterReceiveInterest_count(0)
+  , afterReceiveLoopedInterest_count(0)
   , beforeSatisfyInterest_count(0)
   , afterContentStoreHit_count(0)
   , afterReceiveData_count(0)
@@ -67,6 +68,13 @@ DummyStrategy::afterReceiveInterest(const FaceEndpoint& ingress, const Interest&
   }
 }
 
+void
+DummyStrategy::afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                          const shared_ptr<pit::Entry>& pitEntry)
+{
+  ++afterReceiveLoopedInterest_count;
+}
+
 void
 DummyStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
                                      const FaceEndpoint& ingress, const Data& data)
@@ -66,6 +66,10 @@ public:
   afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
                        const shared_ptr<pit::Entry>& pitEntry) override;
 
+  void
+  afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
+                             const shared_ptr<pit::Entry>& pitEntry) override;
+
   void
   beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
                         const FaceEndpoint& ingress, const Data& data) override;
@@ -100,6 +104,7 @@ protected:
 
 public:
   int afterReceiveInterest_count;
+  int afterReceiveLoopedInterest_count;
   int beforeSatisfyInterest_count;
   int afterContentStoreHit_count;
   int afterReceiveData_count;
@@ -507,6 +507,34 @@ BOOST_AUTO_TEST_CASE(InterestLoopNack)
   BOOST_CHECK(face3->sentNacks.empty());
 }
 
+BOOST_AUTO_TEST_CASE(InterestLoopTrigger)
+{
+  auto face1 = addFace();
+  auto face2 = addFace("dummy://", "dummy://",
+                       ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                       ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                       ndn::nfd::LINK_TYPE_AD_HOC);
+  auto face3 = addFace();
+
+  DummyStrategy& strategy = choose<DummyStrategy>(forwarder, "/", DummyStrategy::getStrategyName());
+  strategy.interestOutFace = face3;
+
+  auto interest = makeInterest("/ALxD5UGIB", false, nullopt, 6082);
+  face1->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 1);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveLoopedInterest_count, 0);
+
+  // looped Interest on ad hoc face, such as a neighbor forwarding the same Interest
+  face2->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 1);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveLoopedInterest_count, 1);
+
+  // Interest with duplicate Nonce in Dead Nonce List has no PIT entry, so it is not dispatched
+  forwarder.getDeadNonceList().add("/ALxD5UGIB/dnl", 6082);
+  face2->receiveInterest(*makeInterest("/ALxD5UGIB/dnl", false, nullopt, 6082), 0);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveLoopedInterest_count, 1);
+}
+
 BOOST_AUTO_TEST_CASE(InterestLoopWithShortLifetime) // Bug 1953
 {
   auto face1 = addFace();
@@ -541,6 +569,36 @@ BOOST_AUTO_TEST_CASE(InterestLoopWithShortLifetime) // Bug 1953
   // an Interest if its Name+Nonce has appeared any point in the past.
 }
 
+BOOST_AUTO_TEST_CASE(InterestLoopAfterSatisfyOnAdHocFace)
+{
+  auto face1 = addFace();
+  auto face2 = addFace("dummy://", "dummy://",
+                       ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                       ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                       ndn::nfd::LINK_TYPE_AD_HOC);
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  // Interest is relayed on the ad hoc face and satisfied
+  auto interest = makeInterest("/A/1", false, nullopt, 3916);
+  face1->receiveInterest(*interest, 0);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 1);
+  face2->receiveData(*makeData("/A/1"), 0);
+  BOOST_CHECK_EQUAL(face1->sentData.size(), 1);
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+
+  // a neighbor relays the same Interest later, which is recognized as a loop
+  // although the Interest does not have MustBeFresh
+  BOOST_CHECK(forwarder.getDeadNonceList().has("/A/1", 3916));
+  face2->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentData.size(), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nCsHits, 0);
+}
+
 BOOST_AUTO_TEST_CASE(PitLeak) // Bug 3484
 {
   auto face1 = addFace();
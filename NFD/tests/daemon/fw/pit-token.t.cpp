@@ -23,6 +23,8 @@
  * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "face/generic-link-service.hpp"
+
 #include "tests/daemon/global-io-fixture.hpp"
 #include "topology-tester.hpp"
 
@@ -71,6 +73,122 @@ BOOST_FIXTURE_TEST_CASE(Downstream, GlobalIoTimeFixture)
   BOOST_CHECK(tokenD == tokenI);
 }
 
+// Upstream returns PIT token issued by the forwarder.
+BOOST_FIXTURE_TEST_CASE(Upstream, GlobalIoTimeFixture)
+{
+  TopologyTester topo;
+  TopologyNode nodeR = topo.addForwarder("R");
+  auto linkC = topo.addBareLink("C", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkS = topo.addBareLink("S", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  topo.registerPrefix(nodeR, linkS->getForwarderFace(), "/U", 5);
+  // Client --- Router --- Server
+  // Client disallows PIT token; Router issues PIT token to Server; Server returns PIT token.
+  auto serviceS = static_cast<face::GenericLinkService*>(linkS->getForwarderFace().getLinkService());
+  auto options = serviceS->getOptions();
+  options.allowPitToken = true;
+  serviceS->setOptions(options);
+
+  // C sends Interests /U/0 and /U/1 without PIT token
+  linkC->receivePacket(makeInterest("/U/0", false, nullopt, 1)->wireEncode());
+  linkC->receivePacket(makeInterest("/U/1", false, nullopt, 2)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // S should receive Interests with distinct PIT tokens
+  BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 2);
+  lp::Packet lppS0(linkS->sentPackets.front());
+  lp::Packet lppS1(linkS->sentPackets.back());
+  BOOST_REQUIRE_EQUAL(lppS0.count<lp::PitTokenField>(), 1);
+  BOOST_REQUIRE_EQUAL(lppS1.count<lp::PitTokenField>(), 1);
+  lp::PitToken token0(lppS0.get<lp::PitTokenField>());
+  lp::PitToken token1(lppS1.get<lp::PitTokenField>());
+  BOOST_CHECK_EQUAL(token0.size(), 8);
+  BOOST_CHECK(token0 != token1);
+
+  // S responds Data /U/0 with its PIT token
+  lp::Packet lppD0(makeData("/U/0")->wireEncode());
+  lppD0.add<lp::PitTokenField>(std::make_pair(token0.cbegin(), token0.cend()));
+  linkS->receivePacket(lppD0.wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // C should receive Data without PIT token
+  BOOST_REQUIRE_EQUAL(linkC->sentPackets.size(), 1);
+  lp::Packet lppC0(linkC->sentPackets.back());
+  BOOST_CHECK_EQUAL(lppC0.count<lp::PitTokenField>(), 0);
+
+  // S responds Data /U/1 with the PIT token of /U/0, which is stale and should be ignored
+  lp::Packet lppD1(makeData("/U/1")->wireEncode());
+  lppD1.add<lp::PitTokenField>(std::make_pair(token0.cbegin(), token0.cend()));
+  linkS->receivePacket(lppD1.wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // C should still receive Data /U/1, matched by name
+  BOOST_REQUIRE_EQUAL(linkC->sentPackets.size(), 2);
+  lp::Packet lppC1(linkC->sentPackets.back());
+  BOOST_CHECK_EQUAL(lppC1.count<lp::PitTokenField>(), 0);
+  BOOST_CHECK_EQUAL(topo.getForwarder(nodeR).getPit().size(), 0);
+
+  // C requests /U/0 again, which is satisfied from the Content Store without the upstream token
+  linkC->receivePacket(makeInterest("/U/0", false, nullopt, 3)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+  BOOST_REQUIRE_EQUAL(linkC->sentPackets.size(), 3);
+  lp::Packet lppC2(linkC->sentPackets.back());
+  BOOST_CHECK_EQUAL(lppC2.count<lp::PitTokenField>(), 0);
+  BOOST_CHECK_EQUAL(linkS->sentPackets.size(), 2);
+}
+
+// Data returning with a PIT token also satisfies other PIT entries it matches.
+BOOST_FIXTURE_TEST_CASE(OtherMatches, GlobalIoTimeFixture)
+{
+  TopologyTester topo;
+  TopologyNode nodeR = topo.addForwarder("R");
+  auto linkC = topo.addBareLink("C", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkD = topo.addBareLink("D", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkS = topo.addBareLink("S", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  topo.registerPrefix(nodeR, linkS->getForwarderFace(), "/U", 5);
+  // Client C, Client D --- Router --- Server
+  // Router issues PIT tokens to Server; Server returns PIT tokens.
+  auto serviceS = static_cast<face::GenericLinkService*>(linkS->getForwarderFace().getLinkService());
+  auto options = serviceS->getOptions();
+  options.allowPitToken = true;
+  serviceS->setOptions(options);
+
+  auto getToken = [&] (size_t i) {
+    lp::Packet lpp(linkS->sentPackets.at(i));
+    return lp::PitToken(lpp.get<lp::PitTokenField>());
+  };
+  auto returnData = [&] (const Name& name, const lp::PitToken& token) {
+    lp::Packet lpp(makeData(name)->wireEncode());
+    lpp.add<lp::PitTokenField>(std::make_pair(token.cbegin(), token.cend()));
+    linkS->receivePacket(lpp.wireEncode());
+    advanceClocks(5_ms, 30_ms);
+  };
+
+  // C sends /U/0, D sends /U with CanBePrefix
+  linkC->receivePacket(makeInterest("/U/0", false, nullopt, 1)->wireEncode());
+  linkD->receivePacket(makeInterest("/U", true, nullopt, 2)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+  BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 2);
+
+  // S responds Data /U/0 with the token of /U/0, which satisfies both Interests
+  returnData("/U/0", getToken(0));
+  BOOST_CHECK_EQUAL(linkC->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(linkD->sentPackets.size(), 1);
+  BOOST_CHECK_EQUAL(topo.getForwarder(nodeR).getPit().size(), 0);
+
+  // C sends /U/1, D sends /U/1 with CanBePrefix, which have distinct PIT entries
+  linkC->receivePacket(makeInterest("/U/1", false, nullopt, 3)->wireEncode());
+  linkD->receivePacket(makeInterest("/U/1", true, nullopt, 4)->wireEncode());
+  advanceClocks(5_ms, 30_ms);
+  BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 4);
+  BOOST_CHECK_EQUAL(topo.getForwarder(nodeR).getPit().size(), 2);
+
+  // S responds Data /U/1 with the token of the CanBePrefix Interest, which satisfies both Interests
+  returnData("/U/1", getToken(3));
+  BOOST_CHECK_EQUAL(linkC->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(linkD->sentPackets.size(), 2);
+  BOOST_CHECK_EQUAL(topo.getForwarder(nodeR).getPit().size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPitToken
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -29,6 +29,7 @@
 
 // All strategies, sorted alphabetically.
 #include "fw/access-strategy.hpp"
+#include "fw/ad-hoc-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
@@ -76,6 +77,7 @@ public:
 
 using Tests = boost::mpl::vector<
   Test<AccessStrategy, false, 1>,
+  Test<AdHocStrategy, false, 1>,
   Test<AsfStrategy, true, 3>,
   Test<BestRouteStrategy, false, 1>,
   Test<BestRouteStrategy2, false, 5>,
@@ -28,6 +28,7 @@
  */
 
 // Strategies implementing recommended Nack processing procedure, sorted alphabetically.
+#include "fw/ad-hoc-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
 #include "fw/random-strategy.hpp"
@@ -87,6 +88,7 @@ public:
 BOOST_AUTO_TEST_SUITE(TestStrategyNackReturn)
 
 using Strategies = boost::mpl::vector<
+  AdHocStrategy,
   BestRouteStrategy2,
   MulticastStrategy,
   RandomStrategy
@@ -30,6 +30,7 @@
 
 // Strategies returning Nack-NoRoute when there is no usable FIB nexthop,
 // sorted alphabetically.
+#include "fw/ad-hoc-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/multicast-strategy.hpp"
@@ -143,6 +144,10 @@ public:
 };
 
 using Tests = boost::mpl::vector<
+  Test<AdHocStrategy, EmptyNextHopList<AdHocStrategy>>,
+  Test<AdHocStrategy, NextHopIsDownstream<AdHocStrategy>>,
+  Test<AdHocStrategy, NextHopViolatesScope<AdHocStrategy>>,
+
   Test<AsfStrategy, EmptyNextHopList<AsfStrategy>>,
   Test<AsfStrategy, NextHopIsDownstream<AsfStrategy>>,
   Test<AsfStrategy, NextHopViolatesScope<AsfStrategy>>,
@@ -33,6 +33,8 @@
 #include "tests/daemon/global-io-fixture.hpp"
 #include "tests/daemon/fw/dummy-strategy.hpp"
 
+#include <boost/filesystem.hpp>
+
 namespace nfd {
 namespace tests {
 
@@ -155,6 +157,55 @@ BOOST_AUTO_TEST_CASE(InvalidValue)
 
 BOOST_AUTO_TEST_SUITE_END() // CsMaxPackets
 
+BOOST_AUTO_TEST_SUITE(CsMaxBytes)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  cs.setLimitBytes(4096);
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), std::numeric_limits<size_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 65536
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), std::numeric_limits<size_t>::max());
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), 65536);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), 65536);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsMaxBytes
+
 BOOST_AUTO_TEST_SUITE(CsPolicy)
 
 BOOST_AUTO_TEST_CASE(Default)
@@ -203,6 +254,76 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsPolicy
 
+class CsPersistentPathFixture : public TablesConfigSectionFixture
+{
+protected:
+  CsPersistentPathFixture()
+    : path(boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "tables-config-section-cs.db")
+  {
+    boost::filesystem::create_directories(path.parent_path());
+  }
+
+  ~CsPersistentPathFixture()
+  {
+    cs.setPersistentStore(nullptr);
+    boost::system::error_code ec;
+    boost::filesystem::remove(path, ec); // ignore error
+  }
+
+protected:
+  const boost::filesystem::path path;
+};
+
+BOOST_FIXTURE_TEST_SUITE(CsPersistentPath, CsPersistentPathFixture)
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_persistent_path )CONFIG" + path.string() + R"CONFIG(
+      cs_persistent_max_size 4096
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK(cs.getPersistentStore() == nullptr);
+
+  runConfig(CONFIG, false);
+  BOOST_REQUIRE(cs.getPersistentStore() != nullptr);
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->getPath(), path.string());
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->getMaxSize(), 4096);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidMaxSize)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_persistent_path /tmp/nfd-cs.db
+      cs_persistent_max_size invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Unopenable)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_persistent_path /nonexistent-directory/nfd-cs.db
+    }
+  )CONFIG";
+
+  BOOST_CHECK_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsPersistentPath
+
 class CsUnsolicitedPolicyFixture : public TablesConfigSectionFixture
 {
 protected:
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-arena.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cstring>
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsArena)
+
+BOOST_AUTO_TEST_CASE(BlockSize)
+{
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(1), 64);
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(64), 64);
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(65), 96);
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(1000), 1024);
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(SlabArena::MAX_BLOCK_SIZE), SlabArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(SlabArena::MAX_BLOCK_SIZE + 1),
+                    SlabArena::MAX_BLOCK_SIZE + 1);
+}
+
+BOOST_AUTO_TEST_CASE(AllocateRelease)
+{
+  SlabArena arena;
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 0);
+
+  // fill more than one slab with blocks of one size class
+  const size_t nBlocks = SlabArena::SLAB_SIZE / 100 + 10;
+  std::vector<uint8_t*> blocks;
+  for (size_t i = 0; i < nBlocks; ++i) {
+    uint8_t* block = arena.allocate(100);
+    std::memset(block, static_cast<int>(i), 100);
+    blocks.push_back(block);
+  }
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 2);
+
+  // blocks do not overlap
+  for (size_t i = 0; i < nBlocks; ++i) {
+    BOOST_CHECK_EQUAL(blocks[i][0], static_cast<uint8_t>(i));
+    BOOST_CHECK_EQUAL(blocks[i][99], static_cast<uint8_t>(i));
+  }
+
+  // another size class uses its own slab
+  uint8_t* small = arena.allocate(10);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+  BOOST_CHECK_EQUAL(arena.getOccupiedBytes(), 3 * SlabArena::SLAB_SIZE);
+
+  // large blocks come from the heap
+  uint8_t* large = arena.allocate(SlabArena::MAX_BLOCK_SIZE + 1);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+  BOOST_CHECK_EQUAL(arena.getOccupiedBytes(), 3 * SlabArena::SLAB_SIZE + SlabArena::MAX_BLOCK_SIZE + 1);
+  arena.deallocate(large, SlabArena::MAX_BLOCK_SIZE + 1);
+
+  // freed blocks are reused
+  arena.deallocate(blocks[0], 100);
+  BOOST_CHECK_EQUAL(arena.allocate(100), blocks[0]);
+
+  // an empty slab is no longer counted, but kept for reuse
+  arena.deallocate(small, 10);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+  BOOST_CHECK_EQUAL(arena.getOccupiedBytes(), 2 * SlabArena::SLAB_SIZE);
+  BOOST_CHECK_EQUAL(arena.allocate(10), small);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+  arena.deallocate(small, 10);
+
+  // other slabs are released when all their blocks are free
+  for (uint8_t* block : blocks) {
+    arena.deallocate(block, 100);
+  }
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 2);
+  BOOST_CHECK_EQUAL(arena.getOccupiedBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(LargeBlocks)
+{
+  SlabArena arena;
+  std::vector<std::pair<uint8_t*, size_t>> blocks;
+
+  // packets of the maximum size, and blocks of the largest size class, fill a slab after its
+  // 64-octet header
+  for (size_t size : {ndn::MAX_NDN_PACKET_SIZE, SlabArena::MAX_BLOCK_SIZE}) {
+    size_t nBlocks = (SlabArena::SLAB_SIZE - 64) / SlabArena::getBlockSize(size);
+    BOOST_CHECK_GE(nBlocks * SlabArena::getBlockSize(size), SlabArena::SLAB_SIZE - 64 * 2);
+    size_t nSlabs = arena.getNSlabs();
+    for (size_t i = 0; i < nBlocks; ++i) {
+      blocks.emplace_back(arena.allocate(size), size);
+    }
+    BOOST_CHECK_EQUAL(arena.getNSlabs(), nSlabs + 1);
+    blocks.emplace_back(arena.allocate(size), size);
+    BOOST_CHECK_EQUAL(arena.getNSlabs(), nSlabs + 2);
+  }
+  BOOST_CHECK_EQUAL(SlabArena::getBlockSize(SlabArena::MAX_BLOCK_SIZE) * 4,
+                    SlabArena::SLAB_SIZE - 64);
+
+  for (const auto& block : blocks) {
+    arena.deallocate(block.first, block.second);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsArena
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
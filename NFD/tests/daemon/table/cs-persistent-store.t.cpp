@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-persistent-store.hpp"
+
+#include "tests/daemon/table/cs-fixture.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+class CsPersistentStoreFixture : public CsFixture
+{
+protected:
+  CsPersistentStoreFixture()
+    : path((boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "cs-persistent-store-test.db").string())
+  {
+    boost::filesystem::create_directories(UNIT_TEST_CONFIG_PATH);
+    boost::filesystem::remove(path);
+    cs.setPersistentStore(make_unique<PersistentStore>(path, 65536));
+  }
+
+  ~CsPersistentStoreFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(path, ec); // ignore error
+  }
+
+  /** \brief simulates a restart: empties the Content Store and reloads it from the file
+   */
+  void
+  restart(size_t maxSize = 65536)
+  {
+    cs.setPersistentStore(nullptr);
+    erase("/", cs.size());
+    BOOST_REQUIRE_EQUAL(cs.size(), 0);
+    cs.setPersistentStore(make_unique<PersistentStore>(path, maxSize));
+  }
+
+protected:
+  const std::string path;
+};
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsPersistentStore, CsPersistentStoreFixture)
+
+BOOST_AUTO_TEST_CASE(Reload)
+{
+  insert(1, "/A/1", [] (Data& data) { data.setFreshnessPeriod(10_s); });
+  insert(2, "/A/2");
+  insert(3, "/A/3");
+  BOOST_CHECK_EQUAL(erase("/A/2", 1), 1);
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 2);
+  advanceClocks(1_s);
+
+  restart();
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 2);
+
+  startInterest("/A/1")
+    .setMustBeFresh(true);
+  CHECK_CS_FIND(1);
+
+  startInterest("/A/2");
+  CHECK_CS_FIND(0);
+
+  startInterest("/A/3");
+  CHECK_CS_FIND(3);
+
+  // reloaded entries keep their remaining freshness
+  advanceClocks(10_s);
+  startInterest("/A/1")
+    .setMustBeFresh(true);
+  CHECK_CS_FIND(0);
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  cs.setLimit(4);
+  for (uint32_t i = 1; i <= 8; ++i) {
+    insert(i, Name("/B").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 4);
+
+  // reloading into a smaller Content Store evicts the oldest entries
+  cs.setLimit(2);
+  restart();
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 2);
+
+  startInterest(Name("/B").appendNumber(6));
+  CHECK_CS_FIND(0);
+  startInterest(Name("/B").appendNumber(8));
+  CHECK_CS_FIND(8);
+}
+
+BOOST_AUTO_TEST_CASE(Compaction)
+{
+  // the file can hold only a few records, so erased records must be reclaimed
+  cs.setLimit(3);
+  restart(1024);
+  for (uint32_t i = 1; i <= 100; ++i) {
+    insert(i, Name("/C").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 3);
+
+  restart(1024);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  for (uint32_t i = 98; i <= 100; ++i) {
+    startInterest(Name("/C").appendNumber(i));
+    CHECK_CS_FIND(i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MalformedRecord)
+{
+  insert(1, "/D/1");
+  insert(2, "/D/2");
+  cs.setPersistentStore(nullptr);
+  erase("/", cs.size());
+
+  // replace the Name of the first record, which follows the file and record headers
+  // and the Data type and length octets
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(34);
+  BOOST_REQUIRE_EQUAL(file.get(), tlv::Name);
+  file.seekp(34);
+  file.put(static_cast<char>(tlv::Content));
+  file.close();
+
+  cs.setPersistentStore(make_unique<PersistentStore>(path, 65536));
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getPersistentStore()->size(), 1);
+
+  startInterest("/D/2");
+  CHECK_CS_FIND(2);
+}
+
+BOOST_AUTO_TEST_CASE(FileTooSmall)
+{
+  cs.setPersistentStore(nullptr);
+  BOOST_CHECK_THROW(PersistentStore(path, 8), PersistentStore::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsPersistentStore
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
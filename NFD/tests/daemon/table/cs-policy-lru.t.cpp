@@ -81,6 +81,54 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByBytes, CsFixture)
+{
+  cs.setPolicy(make_unique<LruPolicy>());
+  cs.setLimit(10);
+
+  // packets of different sizes are held in slabs of different size classes
+  auto setContentSize = [] (size_t size) {
+    return [size] (Data& data) {
+      // keep the id at the beginning of the content
+      std::vector<uint8_t> content(size);
+      std::memcpy(content.data(), data.getContent().value(), sizeof(uint32_t));
+      data.setContent(content.data(), content.size());
+    };
+  };
+  insert(1, "/A", setContentSize(300));
+  insert(2, "/B", setContentSize(700));
+  insert(3, "/C", setContentSize(1300));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  size_t nBytes = cs.getOccupiedBytes();
+  BOOST_CHECK_EQUAL(nBytes, 3 * SlabArena::SLAB_SIZE);
+
+  // evict A, which releases its slab
+  cs.setLimitBytes(nBytes - 1);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_LE(cs.getOccupiedBytes(), cs.getLimitBytes());
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+
+  // use B, then evict C
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  insert(4, "/D", setContentSize(2500));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+  startInterest("/D");
+  CHECK_CS_FIND(4);
+
+  // a packet that fits in an occupied slab evicts nothing
+  insert(5, "/E", setContentSize(700));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(cs.getOccupiedBytes(), 2 * SlabArena::SLAB_SIZE);
+
+  // byte limit is kept when the policy changes
+  cs.setPolicy(make_unique<LruPolicy>());
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), nBytes - 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -87,6 +87,35 @@ BOOST_AUTO_TEST_CASE(FullName_EmptyDataName)
   CHECK_CS_FIND(2);
 }
 
+BOOST_AUTO_TEST_CASE(FullName_EvictAndErase)
+{
+  cs.setLimit(2);
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  Name n3 = insert(3, "/A"); // evicts n1
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  startInterest(n1);
+  CHECK_CS_FIND(0);
+
+  startInterest(n2);
+  CHECK_CS_FIND(2);
+
+  startInterest(n3);
+  CHECK_CS_FIND(3);
+
+  startInterest("/A");
+  find([] (uint32_t found) { BOOST_CHECK(found == 2 || found == 3); });
+
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A");
+  find([] (uint32_t found) { BOOST_CHECK(found == 2 || found == 3); });
+
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+}
+
 BOOST_AUTO_TEST_CASE(PrefixName)
 {
   insert(1, "/A");
@@ -149,6 +149,63 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK(pit.find(*interest) != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(Token)
+{
+  auto interestA = makeInterest("/dtk9N8Hu");
+  auto interestB = makeInterest("/dtk9N8Hu/XJy5");
+
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+
+  auto entryA = pit.insert(*interestA).first;
+  auto entryB = pit.insert(*interestB).first;
+
+  uint64_t tokenA = pit.getToken(entryA);
+  uint64_t tokenB = pit.getToken(entryB);
+  BOOST_CHECK_NE(tokenA, tokenB);
+  BOOST_CHECK_EQUAL(pit.getToken(entryA), tokenA);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenA), entryA);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenB), entryB);
+  BOOST_CHECK(pit.findByToken(tokenB + 1) == nullptr);
+
+  // token is invalidated when the entry is erased, and its slot is reused under a new generation
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.findByToken(tokenA) == nullptr);
+
+  auto entryA2 = pit.insert(*interestA).first;
+  uint64_t tokenA2 = pit.getToken(entryA2);
+  BOOST_CHECK_NE(tokenA2, tokenA);
+  BOOST_CHECK_EQUAL(static_cast<uint32_t>(tokenA2), static_cast<uint32_t>(tokenA));
+  BOOST_CHECK(pit.findByToken(tokenA) == nullptr);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenA2), entryA2);
+  BOOST_CHECK_EQUAL(pit.findByToken(tokenB), entryB);
+}
+
+BOOST_AUTO_TEST_CASE(DataMatchFromEntry)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+
+  auto data = makeData("/A/B");
+  auto entryAB = pit.insert(*makeInterest("/A/B")).first;
+  auto entryA = pit.insert(*makeInterest("/A", true)).first;
+  auto entryA2 = pit.insert(*makeInterest("/A", false)).first; // does not match
+  auto entryFull = pit.insert(*makeInterest(data->getFullName())).first;
+
+  auto toSet = [] (const DataMatchResult& matches) {
+    return std::set<shared_ptr<Entry>>(matches.begin(), matches.end());
+  };
+  std::set<shared_ptr<Entry>> expected{entryAB, entryA, entryFull};
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data)) == expected);
+
+  // no name tree entry below /A/B: matches are collected by walking up
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, *entryAB)) == expected);
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, *entryFull)) == expected);
+
+  // /A has a child: the same matches are found by name
+  BOOST_CHECK(toSet(pit.findAllDataMatches(*data, *entryA)) == expected);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   NameTree nameTree;
@@ -215,5 +215,31 @@ BOOST_FIXTURE_TEST_CASE(FindCanBePrefixHit, CsBenchmarkFixture)
   std::cout << "find(CanBePrefix-hit) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// find hit with exact name, as the number of stored packets grows
+BOOST_FIXTURE_TEST_CASE(FindExactHitScaling, CsBenchmarkFixture)
+{
+  constexpr size_t N_LOOKUPS = 100000;
+  constexpr size_t MAX_SIZE = 1048576;
+
+  cs.setLimit(MAX_SIZE);
+  std::vector<shared_ptr<Interest>> interestWorkload = makeInterestWorkload(MAX_SIZE);
+  size_t nInserted = 0;
+
+  for (size_t size = 16384; size <= MAX_SIZE; size *= 4) {
+    for (; nInserted < size; ++nInserted) {
+      cs.insert(*makeData(interestWorkload[nInserted]->getName()), false);
+    }
+    BOOST_REQUIRE_EQUAL(cs.size(), size);
+
+    time::microseconds d = timedRun([&] {
+      for (size_t i = 0; i < N_LOOKUPS; ++i) {
+        find(*interestWorkload[(i * 7919) % size]);
+      }
+    });
+
+    std::cout << "find(exact-hit) " << N_LOOKUPS << " in " << size << ": " << d << std::endl;
+  }
+}
+
 } // namespace tests
 } // namespace nfd
@@ -149,5 +149,52 @@ BOOST_FIXTURE_TEST_CASE(SimpleExchanges, PitFibBenchmarkFixture)
   std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
 }
 
+// This test case is the same as SimpleExchanges, except that Data are matched to PIT entries
+// through PIT tokens issued when the Interests are forwarded, instead of name lookups.
+BOOST_FIXTURE_TEST_CASE(SimpleExchangesWithPitToken, PitFibBenchmarkFixture)
+{
+  const size_t nRoundTrip = 1000000;
+  const size_t replyGap = 20000;
+  const size_t nFibEntries = 2000;
+  const size_t fibPrefixLength = 1;
+  const size_t interestNameLength= 2;
+  const size_t dataNameLength = 3;
+
+  generatePacketsAndPopulateFib(nRoundTrip, nFibEntries, fibPrefixLength,
+                                interestNameLength, dataNameLength);
+  std::vector<uint64_t> tokens(nRoundTrip);
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  auto t1 = time::steady_clock::now();
+
+  for (size_t i = 0; i < nRoundTrip + replyGap; ++i) {
+    if (i < nRoundTrip) {
+      // process incoming Interest, and issue a PIT token when forwarding it
+      auto pitEntry = m_pit.insert(*interests[i]).first;
+      m_fib.findLongestPrefixMatch(*pitEntry);
+      tokens[i] = m_pit.getToken(pitEntry);
+    }
+    if (i >= replyGap) {
+      // process incoming Data carrying the PIT token
+      auto pitEntry = m_pit.findByToken(tokens[i - replyGap]);
+      // delete matching PIT entry
+      if (pitEntry != nullptr && pitEntry->getInterest().matchesData(*data[i - replyGap])) {
+        m_pit.erase(pitEntry.get());
+      }
+    }
+  }
+
+  auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
+}
+
 } // namespace tests
 } // namespace nfd